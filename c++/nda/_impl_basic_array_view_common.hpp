@@ -343,6 +343,14 @@ void assign_from_ndarray(RHS const &rhs) { // FIXME noexcept {
     long L = size();
     for (long i = 0; i < L; ++i) (*this)(_linear_index_t{i}) = rhs(_linear_index_t{i});
   } else {
+    // If RHS is in memory with a different fastest index (e.g. a permuted_indices_view), use the tiled transposition.
+    // Looping in the order of the LHS would read RHS with a large stride.
+    if constexpr (is_regular_or_view_v<RHS> and (Rank >= 2)) {
+      if (details::fastest_dim(shape(), indexmap().strides()) != details::fastest_dim(shape(), rhs.indexmap().strides())) {
+        details::transpose_apply(shape(), data(), indexmap().strides(), rhs.data(), rhs.indexmap().strides(), [](auto &x, auto const &y) { x = y; });
+        return;
+      }
+    }
     auto l = [this, &rhs](auto const &... args) { (*this)(args...) = rhs(args...); };
     nda::for_each(shape(), l);
   }
@@ -20,7 +20,14 @@
 namespace nda::blas {}
 
 #include "blas/tools.hpp"
+#include "blas/axpy.hpp"
+#include "blas/gbmv.hpp"
 #include "blas/gemm.hpp"
 #include "blas/gemv.hpp"
 #include "blas/ger.hpp"
 #include "blas/dot.hpp"
+#include "blas/scal.hpp"
+#include "blas/spmv.hpp"
+#include "blas/syrk.hpp"
+#include "blas/trmm.hpp"
+#include "blas/trsm.hpp"
@@ -0,0 +1,36 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include "tools.hpp"
+#include "interface/cxx_interface.hpp"
+
+namespace nda::blas {
+
+  /**
+   * y += alpha * x
+   *
+   * @param alpha
+   * @param x Vector, possibly strided
+   * @param y Vector, possibly strided. Can be a temporary view.
+   */
+  template <VectorView X, VectorView Y>
+  void axpy(get_value_t<X> const &alpha, X const &x, Y &&y) {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<X, std::decay_t<Y>>, "axpy : the vectors must have the same blas element type");
+    EXPECTS(x.extent(0) == y.extent(0));
+    f77::axpy(x.extent(0), alpha, x.data(), x.indexmap().strides()[0], y.data(), y.indexmap().strides()[0]);
+  }
+
+} // namespace nda::blas
@@ -0,0 +1,69 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include "tools.hpp"
+#include "interface/cxx_interface.hpp"
+
+namespace nda::blas {
+
+  /**
+   * Band matrix vector product
+   *  y = alpha * op(A) * x + beta * y,  op(A) = A, A^T or A^H
+   *
+   * A is a m x n matrix with kl sub-diagonals and ku super-diagonals, in the lapack band storage :
+   * A(i, j) is ab(ku + i - j, j) for max(0, j - ku) <= i <= min(m - 1, j + kl).
+   * Calls gbmv for blas element types. Other element types use a generic loop.
+   *
+   * @param alpha
+   * @param ab The band storage, a matrix of shape (>= kl + ku + 1, n) in Fortran order, with unit smallest stride
+   * @param m Number of rows of A
+   * @param kl Number of sub-diagonals of A
+   * @param ku Number of super-diagonals of A
+   * @param x
+   * @param beta
+   * @param y The result. Can be a temporary view. If beta == 0, y is not read.
+   * @param trans 'N', 'T' or 'C'
+   */
+  template <MatrixView AB, VectorView X, VectorView Y>
+  void gbmv(get_value_t<Y> const &alpha, AB const &ab, long m, long kl, long ku, X const &x, get_value_t<Y> const &beta, Y &&y, char trans = 'N') {
+    using T = get_value_t<Y>;
+    static_assert(have_same_value_type_v<AB, X, Y>, "gbmv : the band matrix and the vectors must have the same element type");
+    static_assert(std::decay_t<AB>::is_stride_order_Fortran(), "gbmv : the band storage must be in Fortran order");
+    long n = ab.extent(1);
+    EXPECTS(ab.extent(0) >= kl + ku + 1);
+    EXPECTS(trans == 'N' or trans == 'T' or trans == 'C');
+    EXPECTS(x.size() == (trans == 'N' ? n : m) and y.size() == (trans == 'N' ? m : n));
+
+    if constexpr (is_blas_lapack_v<T>) {
+      EXPECTS(ab.indexmap().min_stride() == 1);
+      f77::gbmv(trans, m, n, kl, ku, alpha, ab.data(), get_ld(ab), x.data(), x.indexmap().strides()[0], beta, y.data(), y.indexmap().strides()[0]);
+    } else {
+      if (beta == T{0})
+        y = 0;
+      else
+        y *= beta;
+      for (long j = 0; j < n; ++j)
+        for (long i = std::max(0l, j - ku); i <= std::min(m - 1, j + kl); ++i) {
+          auto a = ab(ku + i - j, j);
+          if (trans == 'N')
+            y(i) += alpha * a * x(j);
+          else
+            y(j) += alpha * (trans == 'C' ? conj(a) : a) * x(i);
+        }
+    }
+  }
+
+} // namespace nda::blas
@@ -17,41 +17,128 @@
 #pragma once
 #include <complex>
 #include "tools.hpp"
+#include "packing.hpp"
 #include "interface/cxx_interface.hpp"
 
 namespace nda::blas {
 
+  namespace details {
+
+    // Block sizes of the generic gemm.
+    // A gemm_mr x gemm_nr tile of c is accumulated in registers, from a panel of gemm_kc x gemm_nr elements of b (L1)
+    // and a block of gemm_mc x gemm_kc elements of a (L2). The packed b is gemm_kc x gemm_nc (L3).
+    constexpr long gemm_mr = 4;
+    constexpr long gemm_nr = 8;
+    constexpr long gemm_mc = 128;
+    constexpr long gemm_kc = 256;
+    constexpr long gemm_nc = 2048;
+
+    // Pack alpha * a(i0 : i0 + mc, k0 : k0 + kc) into panels of gemm_mr rows, each stored column by column.
+    // The last panel is padded with zeros.
+    template <typename T, typename A>
+    void gemm_pack_a(T const &alpha, A const &a, long i0, long mc, long k0, long kc, T *__restrict buf) {
+      for (long ip = 0; ip < mc; ip += gemm_mr) {
+        long mr = std::min(gemm_mr, mc - ip);
+        for (long k = 0; k < kc; ++k, buf += gemm_mr) {
+          for (long i = 0; i < mr; ++i) buf[i] = alpha * static_cast<T>(a(i0 + ip + i, k0 + k));
+          for (long i = mr; i < gemm_mr; ++i) buf[i] = T{0};
+        }
+      }
+    }
+
+    // Pack b(k0 : k0 + kc, j0 : j0 + nc) into panels of gemm_nr columns, each stored row by row.
+    // The last panel is padded with zeros.
+    template <typename T, typename B>
+    void gemm_pack_b(B const &b, long k0, long kc, long j0, long nc, T *__restrict buf) {
+      for (long jp = 0; jp < nc; jp += gemm_nr) {
+        long nr = std::min(gemm_nr, nc - jp);
+        for (long k = 0; k < kc; ++k, buf += gemm_nr) {
+          for (long j = 0; j < nr; ++j) buf[j] = static_cast<T>(b(k0 + k, j0 + jp + j));
+          for (long j = nr; j < gemm_nr; ++j) buf[j] = T{0};
+        }
+      }
+    }
+
+    // c(i0 : i0 + mr, j0 : j0 + nr) += pa * pb, for one packed panel of a and one of b.
+    // The full gemm_mr x gemm_nr tile is always computed (the panels are padded), so that the loops have fixed bounds.
+    template <typename T, typename C>
+    void gemm_micro_kernel(long kc, T const *__restrict pa, T const *__restrict pb, C &c, long i0, long j0, long mr, long nr) {
+      T acc[gemm_mr][gemm_nr];
+      for (auto &row : acc)
+        for (auto &x : row) x = T{0};
+
+      for (long k = 0; k < kc; ++k, pa += gemm_mr, pb += gemm_nr)
+        for (long i = 0; i < gemm_mr; ++i)
+          for (long j = 0; j < gemm_nr; ++j) acc[i][j] += pa[i] * pb[j];
+
+      for (long i = 0; i < mr; ++i)
+        for (long j = 0; j < nr; ++j) c(i0 + i, j0 + j) += acc[i][j];
+    }
+
+  } // namespace details
+
   /**
-   * Compute c <- alpha a*b + beta * c using BLAS dgemm or zgemm 
-   * 
-   * using a generic version for non lapack types or more complex types
-   * largely suboptimal. For testing, or in case of value_type being a complex type.
-   * SHOULD not be used with double and dcomplex
+   * Compute c <- alpha a*b + beta * c for any value type supporting + and *, without BLAS.
+   *
+   * This is the implementation of the matrix product for non lapack types (integers, __float128, user scalar types).
+   * As in a BLAS implementation, a and b are packed block by block into contiguous buffers,
+   * and the product is accumulated by a register blocked micro kernel.
    *
-   * \private : DO NOT DOCUMENT, testing only ??
+   * @param a A matrix or a lazy expression of rank 2. It is only read once per block, during the packing.
+   * @param b A matrix or a lazy expression of rank 2.
+   * @param c Out parameter. Can be a temporary view (hence the &&).
+   *          If beta == 0, c is not read, so it can be uninitialized.
+   *
+   * @Precondition : 
+   *       * c has the correct dimension given a, b. 
+   *         gemm_generic does not resize the object, 
    */
-  template <MatrixView A, MatrixView B, MatrixView Out>
+  template <ArrayOfRank<2> A, ArrayOfRank<2> B, MatrixView Out>
+  void gemm_generic(get_value_t<Out> const &alpha, A const &a, B const &b, get_value_t<Out> const &beta, Out &&c) {
+    using T = get_value_t<Out>;
+    using namespace details;
 
-  void gemm_generic(typename A::value_type alpha, A const &a, B const &b, typename A::value_type beta, Out &c) {
+    EXPECTS(a.shape()[1] == b.shape()[0]);
+    EXPECTS(a.shape()[0] == c.extent(0));
+    EXPECTS(b.shape()[1] == c.extent(1));
 
-    EXPECTS(a.extent(1) == b.extent(0));
-    EXPECTS(a.extent(0) == c.extent(0));
-    EXPECTS(b.extent(1) == c.extent(1));
+    if (beta == T{0})
+      c() = T{0};
+    else if (beta != T{1})
+      c() *= beta;
 
-    c() = 0;
-    for (int i = 0; i < a.extent(0); ++i)
-      for (int j = 0; j < b.extent(1); ++j) {
-        typename A::value_type acc = 0;
-        for (int k = 0; k < a.extent(1); ++k) acc += alpha * a(i, k) * b(k, j);
-        c(i, j) = acc + beta * c(i, j);
+    long M = c.extent(0), N = c.extent(1), K = a.shape()[1];
+    if (M == 0 or N == 0 or K == 0 or alpha == T{0}) return;
+
+    auto round_up = [](long n, long r) { return ((n + r - 1) / r) * r; };
+    array<T, 1> buf_a(round_up(std::min(M, gemm_mc), gemm_mr) * std::min(K, gemm_kc));
+    array<T, 1> buf_b(round_up(std::min(N, gemm_nc), gemm_nr) * std::min(K, gemm_kc));
+
+    for (long j0 = 0; j0 < N; j0 += gemm_nc) {
+      long nc = std::min(gemm_nc, N - j0);
+      for (long k0 = 0; k0 < K; k0 += gemm_kc) {
+        long kc = std::min(gemm_kc, K - k0);
+        gemm_pack_b(b, k0, kc, j0, nc, buf_b.data());
+        for (long i0 = 0; i0 < M; i0 += gemm_mc) {
+          long mc = std::min(gemm_mc, M - i0);
+          gemm_pack_a(alpha, a, i0, mc, k0, kc, buf_a.data());
+          for (long jr = 0; jr < nc; jr += gemm_nr)
+            for (long ir = 0; ir < mc; ir += gemm_mr)
+              gemm_micro_kernel(kc, buf_a.data() + ir * kc, buf_b.data() + jr * kc, c, i0 + ir, j0 + jr, std::min(gemm_mr, mc - ir),
+                                std::min(gemm_nr, nc - jr));
+        }
       }
+    }
   }
 
   /**
    * Compute c <- alpha a*b + beta * c using BLAS dgemm or zgemm 
    *
    * @param c Out parameter. Can be a temporary view (hence the &&).
-   *         
+   *
+   * The operands do not need to be blas compatible : non unit stride views are packed into
+   * reusable scratch buffers before calling blas (or multiplied with gemm_generic if the product is small).
+   *
    * @Precondition : 
    *       * c has the correct dimension given a, b. 
    *         gemm does not resize the object, 
@@ -68,10 +155,21 @@ namespace nda::blas {
     EXPECTS(a.extent(0) == c.extent(0));
     EXPECTS(b.extent(1) == c.extent(1));
 
-    // Must be lapack compatible
-    EXPECTS(a.indexmap().min_stride() == 1);
-    EXPECTS(b.indexmap().min_stride() == 1);
-    EXPECTS(c.indexmap().min_stride() == 1);
+    // Operands which are not blas compatible are either multiplied directly for small sizes,
+    // or packed into Fortran ordered scratch buffers, the result being scattered back into c.
+    if (not details::is_blas_compatible(a) or not details::is_blas_compatible(b) or not details::is_blas_compatible(c)) {
+      if (a.extent(0) * a.extent(1) * b.extent(1) <= details::gemm_packing_threshold) {
+        gemm_generic(alpha, a, b, beta, c);
+        return;
+      }
+      if (not details::is_blas_compatible(a)) return gemm(alpha, details::pack<0>(a), b, beta, c);
+      if (not details::is_blas_compatible(b)) return gemm(alpha, a, details::pack<1>(b), beta, c);
+      // c is only read if beta != 0
+      auto c_packed = details::pack<2>(c, beta != typename A::value_type{0});
+      gemm(alpha, a, b, beta, c_packed);
+      c = c_packed;
+      return;
+    }
 
     // We need to see if C is in Fortran order or C order
     if constexpr (C_t::is_stride_order_C()) {
@@ -16,6 +16,7 @@
 
 #pragma once
 #include "tools.hpp"
+#include "packing.hpp"
 #include "interface/cxx_interface.hpp"
 
 namespace nda::blas {
@@ -26,10 +27,14 @@ namespace nda::blas {
   void gemv_generic(typename A::value_type alpha, A const &a, B const &b, typename A::value_type beta, Out &c) {
     EXPECTS(a.extent(1) == b.extent(0));
     EXPECTS(a.extent(0) == c.extent(0));
-    c() = 0;
+    if (beta == typename A::value_type{0})
+      c() = 0;
+    else
+      c() *= beta;
     for (int i = 0; i < a.extent(0); ++i) {
-      for (int k = 0; k < a.extent(1); ++k) c(i) += alpha * a(i, k) * b(k);
-      c(i) += beta * c(i);
+      get_value_t<Out> acc = 0;
+      for (int k = 0; k < a.extent(1); ++k) acc += a(i, k) * b(k);
+      c(i) += alpha * acc;
     }
   }
 
@@ -45,6 +50,9 @@ namespace nda::blas {
    * @param b
    * @param beta
    * @param c The result. Can be a temporary view. 
+   *
+   * The vectors can have any stride. If the matrix a is not blas compatible (no unit stride),
+   * the product is computed by gemv_generic.
    *         
    * @StaticPrecondition : A, B, C have the same value_type and it is complex<double> or double         
    * @Precondition : 
@@ -67,6 +75,12 @@ namespace nda::blas {
     EXPECTS(a.extent(1) == b.extent(0));
     EXPECTS(a.extent(0) == c.extent(0));
 
+    // A matrix which is not blas compatible is not packed : a copy would cost as much as the product itself
+    if (not details::is_blas_compatible(a)) {
+      gemv_generic(alpha, a, b, beta, c);
+      return;
+    }
+
     char trans_a = get_trans(a, false);
     int m1       = get_n_rows(a);
     int m2       = get_n_cols(a);
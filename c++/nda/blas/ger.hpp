@@ -16,6 +16,7 @@
 
 #pragma once
 #include "tools.hpp"
+#include "packing.hpp"
 #include "interface/cxx_interface.hpp"
 
 namespace nda::blas {
@@ -30,7 +31,7 @@ namespace nda::blas {
    * @param alpha
    * @param x 
    * @param y
-   * @param m The result. Can be a temporary view. 
+   * @param m The result. Can be a temporary view. It does not need to be blas compatible.
    *         
    * @StaticPrecondition : X, Y, M have the same value_type and it is complex<double> or double         
    * @Precondition : 
@@ -51,13 +52,12 @@ namespace nda::blas {
 
     EXPECTS(m.extent(0) == x.extent(0));
     EXPECTS(m.extent(1) == y.extent(0));
-    // Must be lapack compatible
-    EXPECTS(m.indexmap().min_stride() == 1);
-
-    //for (int i = 0; i< x.extent(0); ++i)
-    //for (int j = 0; j< y.extent(0); ++j)
-    //m(i,j) += alpha * x(i) * y(j);
-    //return ;
+    // A matrix which is not blas compatible is updated directly : packing it would cost as much as the update itself
+    if (not details::is_blas_compatible(m)) {
+      for (int i = 0; i < x.extent(0); ++i)
+        for (int j = 0; j < y.extent(0); ++j) m(i, j) += alpha * x(i) * y(j);
+      return;
+    }
 
     auto idx = m.indexmap(); // FIXME should not need a copy
     // if in C, we need to call fortran with transposed matrix
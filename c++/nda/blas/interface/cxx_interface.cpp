@@ -31,14 +31,43 @@ namespace nda::blas::f77 {
     F77_zaxpy(&N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(x), &incx, reinterpret_cast<double *>(Y), // NOLINT
               &incy);                                                                                                                  // NOLINT
   }
+  void axpy(int N, float alpha, const float *x, int incx, float *Y, int incy) { F77_saxpy(&N, &alpha, x, &incx, Y, &incy); }
+  void axpy(int N, std::complex<float> alpha, const std::complex<float> *x, int incx, std::complex<float> *Y, int incy) {
+    F77_caxpy(&N, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(x), &incx, reinterpret_cast<float *>(Y), &incy); // NOLINT
+  }
   // No Const In Wrapping!
   void copy(int N, const double *x, int incx, double *Y, int incy) { F77_dcopy(&N, x, &incx, Y, &incy); }
   void copy(int N, const std::complex<double> *x, int incx, std::complex<double> *Y, int incy) {
     F77_zcopy(&N, reinterpret_cast<const double *>(x), &incx, reinterpret_cast<double *>(Y), &incy); // NOLINT
   }
+  void copy(int N, const float *x, int incx, float *Y, int incy) { F77_scopy(&N, x, &incx, Y, &incy); }
+  void copy(int N, const std::complex<float> *x, int incx, std::complex<float> *Y, int incy) {
+    F77_ccopy(&N, reinterpret_cast<const float *>(x), &incx, reinterpret_cast<float *>(Y), &incy); // NOLINT
+  }
 
   double dot(int M, const double *x, int incx, const double *Y, int incy) { return F77_ddot(&M, x, &incx, Y, &incy); }
 
+  void gbmv(char trans, int M, int N, int KL, int KU, double alpha, const double *A, int LDA, const double *x, int incx, double beta, double *Y,
+            int incy) {
+    F77_dgbmv(&trans, &M, &N, &KL, &KU, &alpha, A, &LDA, x, &incx, &beta, Y, &incy);
+  }
+  void gbmv(char trans, int M, int N, int KL, int KU, std::complex<double> alpha, const std::complex<double> *A, int LDA,
+            const std::complex<double> *x, int incx, std::complex<double> beta, std::complex<double> *Y, int incy) {
+    F77_zgbmv(&trans, &M, &N, &KL, &KU, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA, // NOLINT
+              reinterpret_cast<const double *>(x), &incx, reinterpret_cast<const double *>(&beta),                           // NOLINT
+              reinterpret_cast<double *>(Y), &incy);                                                                       // NOLINT
+  }
+  void gbmv(char trans, int M, int N, int KL, int KU, float alpha, const float *A, int LDA, const float *x, int incx, float beta, float *Y,
+            int incy) {
+    F77_sgbmv(&trans, &M, &N, &KL, &KU, &alpha, A, &LDA, x, &incx, &beta, Y, &incy);
+  }
+  void gbmv(char trans, int M, int N, int KL, int KU, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            const std::complex<float> *x, int incx, std::complex<float> beta, std::complex<float> *Y, int incy) {
+    F77_cgbmv(&trans, &M, &N, &KL, &KU, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(A), &LDA, // NOLINT
+              reinterpret_cast<const float *>(x), &incx, reinterpret_cast<const float *>(&beta),                           // NOLINT
+              reinterpret_cast<float *>(Y), &incy);                                                                       // NOLINT
+  }
+
   void gemm(char trans_a, char trans_b, int M, int N, int K, double alpha, const double *A, int LDA, const double *B, int LDB, double beta, double *C,
             int LDC) {
     F77_dgemm(&trans_a, &trans_b, &M, &N, &K, &alpha, A, &LDA, B, &LDB, &beta, C, &LDC);
@@ -48,6 +77,15 @@ namespace nda::blas::f77 {
     F77_zgemm(&trans_a, &trans_b, &M, &N, &K, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA,      // NOLINT
               reinterpret_cast<const double *>(B), &LDB, reinterpret_cast<const double *>(&beta), reinterpret_cast<double *>(C), &LDC); // NOLINT
   }
+  void gemm(char trans_a, char trans_b, int M, int N, int K, float alpha, const float *A, int LDA, const float *B, int LDB, float beta, float *C,
+            int LDC) {
+    F77_sgemm(&trans_a, &trans_b, &M, &N, &K, &alpha, A, &LDA, B, &LDB, &beta, C, &LDC);
+  }
+  void gemm(char trans_a, char trans_b, int M, int N, int K, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            const std::complex<float> *B, int LDB, std::complex<float> beta, std::complex<float> *C, int LDC) {
+    F77_cgemm(&trans_a, &trans_b, &M, &N, &K, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(A), &LDA,     // NOLINT
+              reinterpret_cast<const float *>(B), &LDB, reinterpret_cast<const float *>(&beta), reinterpret_cast<float *>(C), &LDC); // NOLINT
+  }
 
   void gemv(char trans, int M, int N, double alpha, const double *A, int &LDA, const double *x, int incx, double beta, double *Y, int incy) {
     F77_dgemv(&trans, &M, &N, &alpha, A, &LDA, x, &incx, &beta, Y, &incy);
@@ -57,6 +95,14 @@ namespace nda::blas::f77 {
     F77_zgemv(&trans, &M, &N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA,                        // NOLINT
               reinterpret_cast<const double *>(x), &incx, reinterpret_cast<const double *>(&beta), reinterpret_cast<double *>(Y), &incy); // NOLINT
   }
+  void gemv(char trans, int M, int N, float alpha, const float *A, int &LDA, const float *x, int incx, float beta, float *Y, int incy) {
+    F77_sgemv(&trans, &M, &N, &alpha, A, &LDA, x, &incx, &beta, Y, &incy);
+  }
+  void gemv(char trans, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int &LDA, const std::complex<float> *x, int incx,
+            std::complex<float> beta, std::complex<float> *Y, int incy) {
+    F77_cgemv(&trans, &M, &N, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(A), &LDA,                        // NOLINT
+              reinterpret_cast<const float *>(x), &incx, reinterpret_cast<const float *>(&beta), reinterpret_cast<float *>(Y), &incy); // NOLINT
+  }
 
   void ger(int M, int N, double alpha, const double *x, int incx, const double *Y, int incy, double *A, int LDA) {
     F77_dger(&M, &N, &alpha, x, &incx, Y, &incy, A, &LDA);
@@ -67,15 +113,147 @@ namespace nda::blas::f77 {
               reinterpret_cast<const double *>(Y),                                                          // NOLINT
               &incy, reinterpret_cast<double *>(A), &LDA);                                                  // NOLINT
   }
+  void ger(int M, int N, float alpha, const float *x, int incx, const float *Y, int incy, float *A, int LDA) {
+    F77_sger(&M, &N, &alpha, x, &incx, Y, &incy, A, &LDA);
+  }
+  void ger(int M, int N, std::complex<float> alpha, const std::complex<float> *x, int incx, const std::complex<float> *Y, int incy,
+           std::complex<float> *A, int LDA) {
+    F77_cgeru(&M, &N, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(x), &incx, // NOLINT
+              reinterpret_cast<const float *>(Y),                                                         // NOLINT
+              &incy, reinterpret_cast<float *>(A), &LDA);                                                 // NOLINT
+  }
+
+  void hpmv(char uplo, int N, std::complex<double> alpha, const std::complex<double> *AP, const std::complex<double> *x, int incx,
+            std::complex<double> beta, std::complex<double> *Y, int incy) {
+    F77_zhpmv(&uplo, &N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(AP), // NOLINT
+              reinterpret_cast<const double *>(x), &incx, reinterpret_cast<const double *>(&beta),         // NOLINT
+              reinterpret_cast<double *>(Y), &incy);                                                        // NOLINT
+  }
+  void hpmv(char uplo, int N, std::complex<float> alpha, const std::complex<float> *AP, const std::complex<float> *x, int incx,
+            std::complex<float> beta, std::complex<float> *Y, int incy) {
+    F77_chpmv(&uplo, &N, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(AP), // NOLINT
+              reinterpret_cast<const float *>(x), &incx, reinterpret_cast<const float *>(&beta),         // NOLINT
+              reinterpret_cast<float *>(Y), &incy);                                                       // NOLINT
+  }
+
+  void hpr(char uplo, int N, double alpha, const std::complex<double> *x, int incx, std::complex<double> *AP) {
+    F77_zhpr(&uplo, &N, &alpha, reinterpret_cast<const double *>(x), &incx, reinterpret_cast<double *>(AP)); // NOLINT
+  }
+  void hpr(char uplo, int N, float alpha, const std::complex<float> *x, int incx, std::complex<float> *AP) {
+    F77_chpr(&uplo, &N, &alpha, reinterpret_cast<const float *>(x), &incx, reinterpret_cast<float *>(AP)); // NOLINT
+  }
 
   void scal(int M, double alpha, double *x, int incx) { F77_dscal(&M, &alpha, x, &incx); }
   void scal(int M, std::complex<double> alpha, std::complex<double> *x, int incx) {
     F77_zscal(&M, reinterpret_cast<const double *>(&alpha), reinterpret_cast<double *>(x), &incx); // NOLINT
   }
+  void scal(int M, float alpha, float *x, int incx) { F77_sscal(&M, &alpha, x, &incx); }
+  void scal(int M, std::complex<float> alpha, std::complex<float> *x, int incx) {
+    F77_cscal(&M, reinterpret_cast<const float *>(&alpha), reinterpret_cast<float *>(x), &incx); // NOLINT
+  }
+
+  void spmv(char uplo, int N, double alpha, const double *AP, const double *x, int incx, double beta, double *Y, int incy) {
+    F77_dspmv(&uplo, &N, &alpha, AP, x, &incx, &beta, Y, &incy);
+  }
+  void spmv(char uplo, int N, float alpha, const float *AP, const float *x, int incx, float beta, float *Y, int incy) {
+    F77_sspmv(&uplo, &N, &alpha, AP, x, &incx, &beta, Y, &incy);
+  }
+
+  void spr(char uplo, int N, double alpha, const double *x, int incx, double *AP) { F77_dspr(&uplo, &N, &alpha, x, &incx, AP); }
+  void spr(char uplo, int N, float alpha, const float *x, int incx, float *AP) { F77_sspr(&uplo, &N, &alpha, x, &incx, AP); }
 
   void swap(int N, double *x, int incx, double *Y, int incy) { F77_dswap(&N, x, &incx, Y, &incy); }
   void swap(int N, std::complex<double> *x, int incx, std::complex<double> *Y, int incy) {
     F77_zswap(&N, reinterpret_cast<double *>(x), &incx, reinterpret_cast<double *>(Y), &incy); // NOLINT
   }
+  void swap(int N, float *x, int incx, float *Y, int incy) { F77_sswap(&N, x, &incx, Y, &incy); }
+  void swap(int N, std::complex<float> *x, int incx, std::complex<float> *Y, int incy) {
+    F77_cswap(&N, reinterpret_cast<float *>(x), &incx, reinterpret_cast<float *>(Y), &incy); // NOLINT
+  }
+
+  void syrk(char uplo, char trans, int N, int K, double alpha, const double *A, int LDA, double beta, double *C, int LDC) {
+    F77_dsyrk(&uplo, &trans, &N, &K, &alpha, A, &LDA, &beta, C, &LDC);
+  }
+  void syrk(char uplo, char trans, int N, int K, std::complex<double> alpha, const std::complex<double> *A, int LDA, std::complex<double> beta,
+            std::complex<double> *C, int LDC) {
+    F77_zsyrk(&uplo, &trans, &N, &K, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA, // NOLINT
+              reinterpret_cast<const double *>(&beta), reinterpret_cast<double *>(C), &LDC);                             // NOLINT
+  }
+  void syrk(char uplo, char trans, int N, int K, float alpha, const float *A, int LDA, float beta, float *C, int LDC) {
+    F77_ssyrk(&uplo, &trans, &N, &K, &alpha, A, &LDA, &beta, C, &LDC);
+  }
+  void syrk(char uplo, char trans, int N, int K, std::complex<float> alpha, const std::complex<float> *A, int LDA, std::complex<float> beta,
+            std::complex<float> *C, int LDC) {
+    F77_csyrk(&uplo, &trans, &N, &K, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(A), &LDA, // NOLINT
+              reinterpret_cast<const float *>(&beta), reinterpret_cast<float *>(C), &LDC);                            // NOLINT
+  }
+
+  void herk(char uplo, char trans, int N, int K, double alpha, const std::complex<double> *A, int LDA, double beta, std::complex<double> *C,
+            int LDC) {
+    F77_zherk(&uplo, &trans, &N, &K, &alpha, reinterpret_cast<const double *>(A), &LDA, &beta, reinterpret_cast<double *>(C), &LDC); // NOLINT
+  }
+  void herk(char uplo, char trans, int N, int K, float alpha, const std::complex<float> *A, int LDA, float beta, std::complex<float> *C, int LDC) {
+    F77_cherk(&uplo, &trans, &N, &K, &alpha, reinterpret_cast<const float *>(A), &LDA, &beta, reinterpret_cast<float *>(C), &LDC); // NOLINT
+  }
+
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, double alpha, const double *A, int LDA, double *B, int LDB) {
+    F77_dtrmm(&side, &uplo, &transa, &diag, &M, &N, &alpha, A, &LDA, B, &LDB);
+  }
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int LDA,
+            std::complex<double> *B, int LDB) {
+    F77_ztrmm(&side, &uplo, &transa, &diag, &M, &N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA, // NOLINT
+              reinterpret_cast<double *>(B), &LDB);                                                                                      // NOLINT
+  }
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, float alpha, const float *A, int LDA, float *B, int LDB) {
+    F77_strmm(&side, &uplo, &transa, &diag, &M, &N, &alpha, A, &LDA, B, &LDB);
+  }
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            std::complex<float> *B, int LDB) {
+    F77_ctrmm(&side, &uplo, &transa, &diag, &M, &N, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(A), &LDA, // NOLINT
+              reinterpret_cast<float *>(B), &LDB);                                                                                     // NOLINT
+  }
+
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, double alpha, const double *A, int LDA, double *B, int LDB) {
+    F77_dtrsm(&side, &uplo, &transa, &diag, &M, &N, &alpha, A, &LDA, B, &LDB);
+  }
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int LDA,
+            std::complex<double> *B, int LDB) {
+    F77_ztrsm(&side, &uplo, &transa, &diag, &M, &N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA, // NOLINT
+              reinterpret_cast<double *>(B), &LDB);                                                                                      // NOLINT
+  }
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, float alpha, const float *A, int LDA, float *B, int LDB) {
+    F77_strsm(&side, &uplo, &transa, &diag, &M, &N, &alpha, A, &LDA, B, &LDB);
+  }
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            std::complex<float> *B, int LDB) {
+    F77_ctrsm(&side, &uplo, &transa, &diag, &M, &N, reinterpret_cast<const float *>(&alpha), reinterpret_cast<const float *>(A), &LDA, // NOLINT
+              reinterpret_cast<float *>(B), &LDB);                                                                                     // NOLINT
+  }
+
+  void trmv(char uplo, char trans, char diag, int N, const double *A, int LDA, double *x, int incx) {
+    F77_dtrmv(&uplo, &trans, &diag, &N, A, &LDA, x, &incx);
+  }
+  void trmv(char uplo, char trans, char diag, int N, const std::complex<double> *A, int LDA, std::complex<double> *x, int incx) {
+    F77_ztrmv(&uplo, &trans, &diag, &N, reinterpret_cast<const double *>(A), &LDA, reinterpret_cast<double *>(x), &incx); // NOLINT
+  }
+  void trmv(char uplo, char trans, char diag, int N, const float *A, int LDA, float *x, int incx) {
+    F77_strmv(&uplo, &trans, &diag, &N, A, &LDA, x, &incx);
+  }
+  void trmv(char uplo, char trans, char diag, int N, const std::complex<float> *A, int LDA, std::complex<float> *x, int incx) {
+    F77_ctrmv(&uplo, &trans, &diag, &N, reinterpret_cast<const float *>(A), &LDA, reinterpret_cast<float *>(x), &incx); // NOLINT
+  }
+
+  void trsv(char uplo, char trans, char diag, int N, const double *A, int LDA, double *x, int incx) {
+    F77_dtrsv(&uplo, &trans, &diag, &N, A, &LDA, x, &incx);
+  }
+  void trsv(char uplo, char trans, char diag, int N, const std::complex<double> *A, int LDA, std::complex<double> *x, int incx) {
+    F77_ztrsv(&uplo, &trans, &diag, &N, reinterpret_cast<const double *>(A), &LDA, reinterpret_cast<double *>(x), &incx); // NOLINT
+  }
+  void trsv(char uplo, char trans, char diag, int N, const float *A, int LDA, float *x, int incx) {
+    F77_strsv(&uplo, &trans, &diag, &N, A, &LDA, x, &incx);
+  }
+  void trsv(char uplo, char trans, char diag, int N, const std::complex<float> *A, int LDA, std::complex<float> *x, int incx) {
+    F77_ctrsv(&uplo, &trans, &diag, &N, reinterpret_cast<const float *>(A), &LDA, reinterpret_cast<float *>(x), &incx); // NOLINT
+  }
 
 } // namespace nda::blas::f77
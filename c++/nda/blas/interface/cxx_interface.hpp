@@ -23,30 +23,105 @@ namespace nda::blas::f77 {
 
   void axpy(int N, double alpha, const double *x, int incx, double *Y, int incy);
   void axpy(int N, std::complex<double> alpha, const std::complex<double> *x, int incx, std::complex<double> *Y, int incy);
+  void axpy(int N, float alpha, const float *x, int incx, float *Y, int incy);
+  void axpy(int N, std::complex<float> alpha, const std::complex<float> *x, int incx, std::complex<float> *Y, int incy);
 
   void copy(int N, const double *x, int incx, double *Y, int incy);
   void copy(int N, const std::complex<double> *x, int incx, std::complex<double> *Y, int incy);
+  void copy(int N, const float *x, int incx, float *Y, int incy);
+  void copy(int N, const std::complex<float> *x, int incx, std::complex<float> *Y, int incy);
 
   double dot(int M, const double *x, int incx, const double *Y, int incy);
   //std::complex<double> dot (int  M, const std::complex<double>* x, int  incx, const std::complex<double>* Y, int  incy) ;
 
+  void gbmv(char trans, int M, int N, int KL, int KU, double alpha, const double *A, int LDA, const double *x, int incx, double beta, double *Y,
+            int incy);
+  void gbmv(char trans, int M, int N, int KL, int KU, std::complex<double> alpha, const std::complex<double> *A, int LDA,
+            const std::complex<double> *x, int incx, std::complex<double> beta, std::complex<double> *Y, int incy);
+  void gbmv(char trans, int M, int N, int KL, int KU, float alpha, const float *A, int LDA, const float *x, int incx, float beta, float *Y,
+            int incy);
+  void gbmv(char trans, int M, int N, int KL, int KU, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            const std::complex<float> *x, int incx, std::complex<float> beta, std::complex<float> *Y, int incy);
+
   void gemm(char trans_a, char trans_b, int M, int N, int K, double alpha, const double *A, int LDA, const double *B, int LDB, double beta, double *C,
             int LDC);
   void gemm(char trans_a, char trans_b, int M, int N, int K, std::complex<double> alpha, const std::complex<double> *A, int LDA,
             const std::complex<double> *B, int LDB, std::complex<double> beta, std::complex<double> *C, int LDC);
+  void gemm(char trans_a, char trans_b, int M, int N, int K, float alpha, const float *A, int LDA, const float *B, int LDB, float beta, float *C,
+            int LDC);
+  void gemm(char trans_a, char trans_b, int M, int N, int K, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            const std::complex<float> *B, int LDB, std::complex<float> beta, std::complex<float> *C, int LDC);
 
   void gemv(char trans, int M, int N, double alpha, const double *A, int &LDA, const double *x, int incx, double beta, double *Y, int incy);
   void gemv(char trans, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int &LDA, const std::complex<double> *x, int incx,
             std::complex<double> beta, std::complex<double> *Y, int incy);
+  void gemv(char trans, int M, int N, float alpha, const float *A, int &LDA, const float *x, int incx, float beta, float *Y, int incy);
+  void gemv(char trans, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int &LDA, const std::complex<float> *x, int incx,
+            std::complex<float> beta, std::complex<float> *Y, int incy);
 
   void ger(int M, int N, double alpha, const double *x, int incx, const double *Y, int incy, double *A, int LDA);
   void ger(int M, int N, std::complex<double> alpha, const std::complex<double> *x, int incx, const std::complex<double> *Y, int incy,
            std::complex<double> *A, int LDA);
+  void ger(int M, int N, float alpha, const float *x, int incx, const float *Y, int incy, float *A, int LDA);
+  void ger(int M, int N, std::complex<float> alpha, const std::complex<float> *x, int incx, const std::complex<float> *Y, int incy,
+           std::complex<float> *A, int LDA);
+
+  void hpmv(char uplo, int N, std::complex<double> alpha, const std::complex<double> *AP, const std::complex<double> *x, int incx,
+            std::complex<double> beta, std::complex<double> *Y, int incy);
+  void hpmv(char uplo, int N, std::complex<float> alpha, const std::complex<float> *AP, const std::complex<float> *x, int incx,
+            std::complex<float> beta, std::complex<float> *Y, int incy);
+
+  void hpr(char uplo, int N, double alpha, const std::complex<double> *x, int incx, std::complex<double> *AP);
+  void hpr(char uplo, int N, float alpha, const std::complex<float> *x, int incx, std::complex<float> *AP);
 
   void scal(int M, double alpha, double *x, int incx);
   void scal(int M, std::complex<double> alpha, std::complex<double> *x, int incx);
+  void scal(int M, float alpha, float *x, int incx);
+  void scal(int M, std::complex<float> alpha, std::complex<float> *x, int incx);
+
+  void spmv(char uplo, int N, double alpha, const double *AP, const double *x, int incx, double beta, double *Y, int incy);
+  void spmv(char uplo, int N, float alpha, const float *AP, const float *x, int incx, float beta, float *Y, int incy);
+
+  void spr(char uplo, int N, double alpha, const double *x, int incx, double *AP);
+  void spr(char uplo, int N, float alpha, const float *x, int incx, float *AP);
 
   void swap(int N, double *x, int incx, double *Y, int incy);
   void swap(int N, std::complex<double> *x, int incx, std::complex<double> *Y, int incy);
+  void swap(int N, float *x, int incx, float *Y, int incy);
+  void swap(int N, std::complex<float> *x, int incx, std::complex<float> *Y, int incy);
+
+  void syrk(char uplo, char trans, int N, int K, double alpha, const double *A, int LDA, double beta, double *C, int LDC);
+  void syrk(char uplo, char trans, int N, int K, std::complex<double> alpha, const std::complex<double> *A, int LDA, std::complex<double> beta,
+            std::complex<double> *C, int LDC);
+  void syrk(char uplo, char trans, int N, int K, float alpha, const float *A, int LDA, float beta, float *C, int LDC);
+  void syrk(char uplo, char trans, int N, int K, std::complex<float> alpha, const std::complex<float> *A, int LDA, std::complex<float> beta,
+            std::complex<float> *C, int LDC);
+
+  void herk(char uplo, char trans, int N, int K, double alpha, const std::complex<double> *A, int LDA, double beta, std::complex<double> *C, int LDC);
+  void herk(char uplo, char trans, int N, int K, float alpha, const std::complex<float> *A, int LDA, float beta, std::complex<float> *C, int LDC);
+
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, double alpha, const double *A, int LDA, double *B, int LDB);
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int LDA,
+            std::complex<double> *B, int LDB);
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, float alpha, const float *A, int LDA, float *B, int LDB);
+  void trmm(char side, char uplo, char transa, char diag, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            std::complex<float> *B, int LDB);
+
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, double alpha, const double *A, int LDA, double *B, int LDB);
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int LDA,
+            std::complex<double> *B, int LDB);
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, float alpha, const float *A, int LDA, float *B, int LDB);
+  void trsm(char side, char uplo, char transa, char diag, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int LDA,
+            std::complex<float> *B, int LDB);
+
+  void trmv(char uplo, char trans, char diag, int N, const double *A, int LDA, double *x, int incx);
+  void trmv(char uplo, char trans, char diag, int N, const std::complex<double> *A, int LDA, std::complex<double> *x, int incx);
+  void trmv(char uplo, char trans, char diag, int N, const float *A, int LDA, float *x, int incx);
+  void trmv(char uplo, char trans, char diag, int N, const std::complex<float> *A, int LDA, std::complex<float> *x, int incx);
+
+  void trsv(char uplo, char trans, char diag, int N, const double *A, int LDA, double *x, int incx);
+  void trsv(char uplo, char trans, char diag, int N, const std::complex<double> *A, int LDA, std::complex<double> *x, int incx);
+  void trsv(char uplo, char trans, char diag, int N, const float *A, int LDA, float *x, int incx);
+  void trsv(char uplo, char trans, char diag, int N, const std::complex<float> *A, int LDA, std::complex<float> *x, int incx);
 
 } // namespace nda::blas::f77
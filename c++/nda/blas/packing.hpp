@@ -0,0 +1,55 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+#include <vector>
+#include "tools.hpp"
+
+namespace nda::blas::details {
+
+  // Below this number of multiply-adds, gemm multiplies non blas compatible operands directly with gemm_generic,
+  // rather than packing them into blas compatible buffers.
+  constexpr long gemm_packing_threshold = 32 * 32 * 32;
+
+  // Can the matrix be passed to blas directly ? Its elements must be contiguous in one of the two dimensions.
+  template <MatrixView A>
+  bool is_blas_compatible(A const &a) {
+    return a.indexmap().min_stride() == 1;
+  }
+
+  // A thread local scratch buffer of at least size elements, reused from one call to the next to avoid allocations.
+  // Slot distinguishes the buffers used simultaneously in one blas call.
+  template <typename T, int Slot>
+  T *scratch_buffer(long size) {
+    thread_local std::vector<T> buf;
+    if (buf.size() < size) buf.resize(size);
+    return buf.data();
+  }
+
+  // A view on the scratch buffer Slot, with the shape of a : a Fortran ordered matrix, or a vector.
+  // If copy_in, a (which can be a lazy expression) is copied into it, and converted to T if T is not void.
+  template <int Slot, typename T = void, Array A>
+  auto pack(A const &a, bool copy_in = true) {
+    static_assert(get_rank<A> == 1 or get_rank<A> == 2, "pack : only vectors and matrices can be packed");
+    using value_t  = std::conditional_t<std::is_void_v<T>, std::remove_const_t<get_value_t<A>>, T>;
+    using layout_t = std::conditional_t<get_rank<A> == 2, F_layout, C_layout>;
+    using view_t   = basic_array_view<value_t, get_rank<A>, layout_t, get_algebra<A>, default_accessor, borrowed>;
+    auto r         = view_t{a.shape(), scratch_buffer<value_t, Slot>(stdutil::product(a.shape()))};
+    if (copy_in) r = a;
+    return r;
+  }
+
+} // namespace nda::blas::details
@@ -0,0 +1,90 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include "tools.hpp"
+#include "interface/cxx_interface.hpp"
+#include "../layout/packed_idx_map.hpp"
+
+namespace nda::blas {
+
+  /**
+   * Symmetric (real) or hermitian (complex) matrix vector product with a packed matrix
+   *  y = alpha * A * x + beta * y
+   *
+   * Calls spmv for real and hpmv for complex element types. Other element types use a generic loop.
+   *
+   * @param alpha
+   * @param ap The triangle of A in packed storage (cf. packed_idx_map), contiguous
+   * @param x
+   * @param beta
+   * @param y The result. Can be a temporary view. If beta == 0, y is not read.
+   * @param uplo 'U' (resp. 'L') if ap holds the upper (resp. lower) triangle of A
+   */
+  template <VectorView AP, VectorView X, VectorView Y>
+  void spmv(get_value_t<Y> const &alpha, AP const &ap, X const &x, get_value_t<Y> const &beta, Y &&y, char uplo = 'U') {
+    using T = get_value_t<Y>;
+    static_assert(have_same_value_type_v<AP, X, Y>, "spmv : the packed matrix and the vectors must have the same element type");
+    auto idx = packed_idx_map{packed_idx_map::dim_from_size(ap.size()), uplo};
+    EXPECTS(ap.indexmap().min_stride() == 1);
+    EXPECTS(x.size() == idx.dim() and y.size() == idx.dim());
+
+    if constexpr (is_blas_lapack_v<T>) {
+      int incx = x.indexmap().strides()[0], incy = y.indexmap().strides()[0];
+      if constexpr (is_complex_v<T>)
+        f77::hpmv(uplo, idx.dim(), alpha, ap.data(), x.data(), incx, beta, y.data(), incy);
+      else
+        f77::spmv(uplo, idx.dim(), alpha, ap.data(), x.data(), incx, beta, y.data(), incy);
+    } else {
+      for (long i = 0; i < idx.dim(); ++i) {
+        T s{0};
+        for (long j = 0; j < idx.dim(); ++j) s += (idx.is_stored(i, j) ? ap(idx(i, j)) : conj(ap(idx(j, i)))) * x(j);
+        y(i) = (beta == T{0} ? alpha * s : alpha * s + beta * y(i));
+      }
+    }
+  }
+
+  /**
+   * Rank 1 update of a symmetric (real) or hermitian (complex) packed matrix
+   *  A += alpha * x * x^H
+   *
+   * Calls spr for real and hpr for complex element types.
+   *
+   * @param alpha A real number, so that A stays hermitian
+   * @param x
+   * @param ap The triangle of A in packed storage (cf. packed_idx_map), contiguous
+   * @param uplo 'U' (resp. 'L') if ap holds the upper (resp. lower) triangle of A
+   */
+  template <VectorView X, VectorView AP>
+  void spr(real_value_t<get_value_t<X>> alpha, X const &x, AP &&ap, char uplo = 'U') {
+    using T = get_value_t<X>;
+    static_assert(have_same_value_type_v<AP, X>, "spr : the packed matrix and the vector must have the same element type");
+    auto idx = packed_idx_map{packed_idx_map::dim_from_size(ap.size()), uplo};
+    EXPECTS(ap.indexmap().min_stride() == 1);
+    EXPECTS(x.size() == idx.dim());
+
+    if constexpr (is_blas_lapack_v<T>) {
+      if constexpr (is_complex_v<T>)
+        f77::hpr(uplo, idx.dim(), alpha, x.data(), x.indexmap().strides()[0], ap.data());
+      else
+        f77::spr(uplo, idx.dim(), alpha, x.data(), x.indexmap().strides()[0], ap.data());
+    } else {
+      for (long j = 0; j < idx.dim(); ++j)
+        for (long i = 0; i < idx.dim(); ++i)
+          if (idx.is_stored(i, j)) ap(idx(i, j)) += alpha * x(i) * conj(x(j));
+    }
+  }
+
+} // namespace nda::blas
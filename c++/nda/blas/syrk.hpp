@@ -0,0 +1,115 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include "tools.hpp"
+#include "interface/cxx_interface.hpp"
+
+namespace nda::blas {
+
+  namespace details {
+
+    // Complete the square matrix c from the triangle computed by syrk/herk.
+    // blas computes the upper triangle of the matrix it sees, i.e. the lower one of c in C order.
+    // For herk, the computed triangle is first conjugated if conjugate, and the other triangle is its adjoint.
+    template <bool Hermitian, typename C>
+    void complete_from_triangle(C &&c, [[maybe_unused]] bool conjugate) {
+      constexpr bool c_is_c = std::decay_t<C>::is_stride_order_C();
+      long n                = c.extent(0);
+      for (long j = 0; j < n; ++j) {
+        for (long i = 0; i < j; ++i) {
+          auto &src = (c_is_c ? c(j, i) : c(i, j));
+          auto &dst = (c_is_c ? c(i, j) : c(j, i));
+          if constexpr (Hermitian) {
+            if (conjugate) src = std::conj(src);
+            dst = std::conj(src);
+          } else {
+            dst = src;
+          }
+        }
+        if constexpr (Hermitian) {
+          if (conjugate) c(j, j) = std::conj(c(j, j));
+        }
+      }
+    }
+
+  } // namespace details
+
+  /**
+   * Symmetric rank k update, the full matrix c being computed
+   *  c = alpha * a * a^T + beta * c (op = 'N') or c = alpha * a^T * a + beta * c (op = 'T')
+   *
+   * blas computes only one triangle of the result (half of the flops of gemm), the other one is mirrored.
+   * For complex types, the product is symmetric, not hermitian (cf. herk).
+   *
+   * @param alpha
+   * @param a Matrix with unit smallest stride, C or Fortran order
+   * @param beta
+   * @param c The result, a square matrix with unit smallest stride. It must be symmetric if beta != 0.
+   * @param op 'N' or 'T'
+   */
+  template <MatrixView A, MatrixView C>
+  void syrk(get_value_t<A> const &alpha, A const &a, get_value_t<A> const &beta, C &&c, char op = 'N') {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<A, std::decay_t<C>>, "syrk : the matrices must have the same blas element type");
+    EXPECTS(op == 'N' or op == 'T');
+    long n = a.extent(op == 'N' ? 0 : 1);
+    long k = a.extent(op == 'N' ? 1 : 0);
+    EXPECTS(c.extent(0) == n and c.extent(1) == n);
+    EXPECTS(a.indexmap().min_stride() == 1 and c.indexmap().min_stride() == 1);
+    if (n == 0) return;
+
+    // In C order, blas sees a^T : a * a^T is a^T^T * a^T
+    char trans = ((op == 'N') xor A::is_stride_order_C()) ? 'N' : 'T';
+    f77::syrk('U', trans, n, k, alpha, a.data(), get_ld(a), beta, c.data(), get_ld(c));
+    details::complete_from_triangle<false>(c, false);
+  }
+
+  /**
+   * Hermitian rank k update, the full matrix c being computed
+   *  c = alpha * a * a^H + beta * c (op = 'N') or c = alpha * a^H * a + beta * c (op = 'C')
+   *
+   * blas computes only one triangle of the result (half of the flops of gemm), the other one is mirrored.
+   *
+   * @param alpha Real
+   * @param a Complex matrix with unit smallest stride, C or Fortran order
+   * @param beta Real
+   * @param c The result, a square matrix with unit smallest stride. It must be hermitian if beta != 0.
+   * @param op 'N' or 'C'
+   */
+  template <MatrixView A, MatrixView C>
+  void herk(real_value_t<get_value_t<A>> alpha, A const &a, real_value_t<get_value_t<A>> beta, C &&c, char op = 'N') {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<A, std::decay_t<C>>, "herk : the matrices must have the same blas element type");
+    static_assert(is_complex_v<get_value_t<A>>, "herk : the element type must be complex. Use syrk for real types");
+    EXPECTS(op == 'N' or op == 'C');
+    long n = a.extent(op == 'N' ? 0 : 1);
+    long k = a.extent(op == 'N' ? 1 : 0);
+    EXPECTS(c.extent(0) == n and c.extent(1) == n);
+    EXPECTS(a.indexmap().min_stride() == 1 and c.indexmap().min_stride() == 1);
+    if (n == 0) return;
+
+    // In C order, blas sees a^T : a * a^H is conj(a^T^H * a^T), and blas sees c^T = conj(c) for a hermitian c.
+    // The result is then computed as conj(c) when a and c have different orders.
+    constexpr bool a_is_c    = A::is_stride_order_C();
+    constexpr bool conjugate = a_is_c xor std::decay_t<C>::is_stride_order_C();
+    if (conjugate and beta != 0) {
+      for (long i = 0; i < n; ++i)
+        for (long j = 0; j < n; ++j) c(i, j) = std::conj(c(i, j));
+    }
+    char trans = ((op == 'N') xor a_is_c) ? 'N' : 'C';
+    f77::herk('U', trans, n, k, alpha, a.data(), get_ld(a), beta, c.data(), get_ld(c));
+    details::complete_from_triangle<true>(c, conjugate);
+  }
+
+} // namespace nda::blas
@@ -27,18 +27,25 @@ namespace nda {
 namespace nda::blas {
 
   // a trait to detect all types for which blas/lapack bindings is defined
-  // at the moment double and std::complex<double>
-  // We don't need simple precision for the moment... To be added ?
+  // at the moment float, double, std::complex<float> and std::complex<double>
   template <typename T>
   struct _is_blas_lapack : std::false_type {};
   template <>
+  struct _is_blas_lapack<float> : std::true_type {};
+  template <>
   struct _is_blas_lapack<double> : std::true_type {};
   template <>
+  struct _is_blas_lapack<std::complex<float>> : std::true_type {};
+  template <>
   struct _is_blas_lapack<std::complex<double>> : std::true_type {};
 
   template <typename T>
   inline constexpr bool is_blas_lapack_v = _is_blas_lapack<std::remove_const_t<T>>::value;
 
+  // the real type of a blas/lapack type, i.e. the type of its norms, singular values, eigenvalues, ...
+  template <typename T>
+  using real_value_t = decltype(std::real(std::declval<std::remove_const_t<T>>()));
+
   // check all A have the same element_type
   // remove the ref here, this trait is exposed in the doc, it is simpler
   template <typename A0, typename... A>
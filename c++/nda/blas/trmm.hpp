@@ -0,0 +1,89 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include "tools.hpp"
+#include "interface/cxx_interface.hpp"
+
+namespace nda::blas {
+
+  namespace details {
+
+    // The uplo and trans arguments of the blas triangular routines for op(a), op = 'N' or 'T', a being the triangle uplo of a.
+    // In C order, blas sees the transpose of a : the triangle is flipped, and so is the transposition.
+    template <typename A>
+    std::pair<char, char> triangular_args(char uplo, char trans) {
+      EXPECTS(uplo == 'U' or uplo == 'L');
+      EXPECTS(trans == 'N' or trans == 'T');
+      constexpr bool a_is_c = std::decay_t<A>::is_stride_order_C();
+      if (not a_is_c) return {uplo, trans};
+      return {(uplo == 'U' ? 'L' : 'U'), (trans == 'N' ? 'T' : 'N')};
+    }
+
+    // The side and trans arguments of trmm/trsm, for a matrix b seen by blas.
+    // In C order, blas sees b^T : op(a) * b becomes b^T * op(a)^T, i.e. the side and the transposition are flipped.
+    template <typename B>
+    std::pair<char, char> triangular_side(char side, char trans) {
+      EXPECTS(side == 'L' or side == 'R');
+      if (not std::decay_t<B>::is_stride_order_C()) return {side, trans};
+      return {(side == 'L' ? 'R' : 'L'), (trans == 'N' ? 'T' : 'N')};
+    }
+
+  } // namespace details
+
+  /**
+   * Triangular matrix product, in place
+   *  b = alpha * op(a) * b (side = 'L') or b = alpha * b * op(a) (side = 'R'), op(a) = a or a^T
+   *
+   * @param alpha
+   * @param a Square matrix, of which only the triangle uplo is referenced. Unit smallest stride, C or Fortran order.
+   * @param b The matrix to multiply, overwritten by the result. Unit smallest stride, C or Fortran order.
+   * @param uplo 'U' or 'L' : the triangle of a
+   * @param diag 'N', or 'U' if a has a unit diagonal (which is then not referenced)
+   * @param side 'L' or 'R'
+   * @param trans 'N' or 'T'
+   */
+  template <MatrixView A, MatrixView B>
+  void trmm(get_value_t<A> const &alpha, A const &a, B &&b, char uplo, char diag = 'N', char side = 'L', char trans = 'N') {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<A, std::decay_t<B>>, "trmm : the matrices must have the same blas element type");
+    EXPECTS(a.extent(0) == a.extent(1));
+    EXPECTS(b.extent(side == 'L' ? 0 : 1) == a.extent(0));
+    EXPECTS(a.indexmap().min_stride() == 1 and b.indexmap().min_stride() == 1);
+    auto [uplo_f, trans_a] = details::triangular_args<A>(uplo, trans);
+    auto [side_f, trans_f] = details::triangular_side<B>(side, trans_a);
+    f77::trmm(side_f, uplo_f, trans_f, diag, get_n_rows(b), get_n_cols(b), alpha, a.data(), get_ld(a), b.data(), get_ld(b));
+  }
+
+  /**
+   * Triangular matrix vector product, in place
+   *  x = op(a) * x, op(a) = a or a^T
+   *
+   * @param a Square matrix, of which only the triangle uplo is referenced. Unit smallest stride, C or Fortran order.
+   * @param x The vector to multiply, overwritten by the result
+   * @param uplo 'U' or 'L' : the triangle of a
+   * @param diag 'N', or 'U' if a has a unit diagonal (which is then not referenced)
+   * @param trans 'N' or 'T'
+   */
+  template <MatrixView A, VectorView X>
+  void trmv(A const &a, X &&x, char uplo, char diag = 'N', char trans = 'N') {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<A, std::decay_t<X>>,
+                  "trmv : the matrix and the vector must have the same blas element type");
+    EXPECTS(a.extent(0) == a.extent(1) and x.extent(0) == a.extent(0));
+    EXPECTS(a.indexmap().min_stride() == 1);
+    auto [uplo_f, trans_f] = details::triangular_args<A>(uplo, trans);
+    f77::trmv(uplo_f, trans_f, diag, a.extent(0), a.data(), get_ld(a), x.data(), x.indexmap().strides()[0]);
+  }
+
+} // namespace nda::blas
@@ -0,0 +1,64 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include "trmm.hpp"
+
+namespace nda::blas {
+
+  /**
+   * Triangular solve with multiple right hand sides, in place
+   *  op(a) * x = alpha * b (side = 'L') or x * op(a) = alpha * b (side = 'R'), op(a) = a or a^T, b being overwritten by x
+   *
+   * @param alpha
+   * @param a Square triangular matrix, of which only the triangle uplo is referenced. Unit smallest stride, C or Fortran order.
+   * @param b The right hand sides, overwritten by the solution. Unit smallest stride, C or Fortran order.
+   * @param uplo 'U' or 'L' : the triangle of a
+   * @param diag 'N', or 'U' if a has a unit diagonal (which is then not referenced)
+   * @param side 'L' or 'R'
+   * @param trans 'N' or 'T'
+   */
+  template <MatrixView A, MatrixView B>
+  void trsm(get_value_t<A> const &alpha, A const &a, B &&b, char uplo, char diag = 'N', char side = 'L', char trans = 'N') {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<A, std::decay_t<B>>, "trsm : the matrices must have the same blas element type");
+    EXPECTS(a.extent(0) == a.extent(1));
+    EXPECTS(b.extent(side == 'L' ? 0 : 1) == a.extent(0));
+    EXPECTS(a.indexmap().min_stride() == 1 and b.indexmap().min_stride() == 1);
+    auto [uplo_f, trans_a] = details::triangular_args<A>(uplo, trans);
+    auto [side_f, trans_f] = details::triangular_side<B>(side, trans_a);
+    f77::trsm(side_f, uplo_f, trans_f, diag, get_n_rows(b), get_n_cols(b), alpha, a.data(), get_ld(a), b.data(), get_ld(b));
+  }
+
+  /**
+   * Triangular solve with one right hand side, in place
+   *  op(a) * x = b, op(a) = a or a^T, b being overwritten by x
+   *
+   * @param a Square triangular matrix, of which only the triangle uplo is referenced. Unit smallest stride, C or Fortran order.
+   * @param b The right hand side, overwritten by the solution
+   * @param uplo 'U' or 'L' : the triangle of a
+   * @param diag 'N', or 'U' if a has a unit diagonal (which is then not referenced)
+   * @param trans 'N' or 'T'
+   */
+  template <MatrixView A, VectorView X>
+  void trsv(A const &a, X &&b, char uplo, char diag = 'N', char trans = 'N') {
+    static_assert(have_same_element_type_and_it_is_blas_type_v<A, std::decay_t<X>>,
+                  "trsv : the matrix and the vector must have the same blas element type");
+    EXPECTS(a.extent(0) == a.extent(1) and b.extent(0) == a.extent(0));
+    EXPECTS(a.indexmap().min_stride() == 1);
+    auto [uplo_f, trans_f] = details::triangular_args<A>(uplo, trans);
+    f77::trsv(uplo_f, trans_f, diag, a.extent(0), a.data(), get_ld(a), b.data(), b.indexmap().strides()[0]);
+  }
+
+} // namespace nda::blas
@@ -19,6 +19,7 @@
 
 #include "nda.hpp"
 #include "blas/tools.hpp"
+#include "layout/packed_idx_map.hpp"
 #include "lapack/interface/lapack_cxx_interface.hpp"
 
 /// LAPACK Interface
@@ -29,6 +30,7 @@ namespace nda::lapack {
   using blas::get_n_rows;
   using blas::have_same_value_type_v;
   using blas::is_blas_lapack_v;
+  using blas::real_value_t;
 
   using blas::IsDoubleOrComplex;
   using blas::MatrixView;
@@ -36,9 +38,25 @@ namespace nda::lapack {
 
 } // namespace nda::lapack
 
+#include "lapack/eigen_workspace.hpp"
+#include "lapack/gbsv.hpp"
+#include "lapack/gbtrf.hpp"
+#include "lapack/gbtrs.hpp"
+#include "lapack/geev.hpp"
 #include "lapack/gelss.hpp"
+#include "lapack/geqp3.hpp"
+#include "lapack/geqrf.hpp"
+#include "lapack/gesdd.hpp"
+#include "lapack/gesv_mixed.hpp"
 #include "lapack/gesvd.hpp"
 #include "lapack/getrf.hpp"
 #include "lapack/getri.hpp"
 #include "lapack/getrs.hpp"
 #include "lapack/gtsv.hpp"
+#include "lapack/orgqr.hpp"
+#include "lapack/potrf.hpp"
+#include "lapack/potri.hpp"
+#include "lapack/potrs.hpp"
+#include "lapack/spev.hpp"
+#include "lapack/sptrf.hpp"
+#include "lapack/sygvd.hpp"
@@ -0,0 +1,59 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Workspace of the eigensolvers geev and sygvd, owned by the caller and reused from one call to the next.
+   * The arrays are only resized when they are too small : repeated calls with the same dimension do not allocate.
+   *
+   * @tparam T Element type of the matrices
+   */
+  template <typename T>
+  struct eigen_workspace {
+    /// The work array of lapack
+    array<T, 1> work;
+
+    /// The real work array : rwork for complex types, the real and imaginary parts of the eigenvalues of geev for real types
+    array<real_value_t<T>, 1> rwork;
+
+    /// The integer work array
+    array<int, 1> iwork;
+
+    /// The left and right eigenvectors computed by geev, in Fortran order, for nda::linalg::general_eigenelements_in_place
+    matrix<T, F_layout> v1, v2;
+  };
+
+  namespace details {
+
+    // Resize the vector v if its size is smaller than n
+    template <typename V>
+    void reserve_workspace(V &v, long n) {
+      if (v.size() < n) v.resize(n);
+    }
+
+    // Resize the matrix v if it is smaller than n x n, and return its top left n x n block
+    template <typename T>
+    auto reserve_workspace(matrix<T, F_layout> &v, long n) {
+      if (v.extent(0) < n or v.extent(1) < n) v.resize(n, n);
+      return v(range(0, n), range(0, n));
+    }
+
+  } // namespace details
+
+} // namespace nda::lapack
@@ -0,0 +1,56 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Solve A * X = B for a n x n band matrix A with kl sub-diagonals and ku super-diagonals (gbtrf followed by gbtrs).
+   * It generalizes gtsv (kl = ku = 1) to any bandwidth, in O(n * kl * (kl + ku)) operations.
+   *
+   * @param ab The band storage, cf. gbtrf. On return, it contains the L and U factors.
+   * @param kl Number of sub-diagonals
+   * @param ku Number of super-diagonals
+   * @param ipiv The pivots, resized to n if necessary
+   * @param b Vector, or matrix in Fortran order, with unit smallest stride. It is overwritten by the solution X.
+   */
+  template <MatrixView AB, ArrayOfRank<1> IPIV, MemoryArray B>
+  [[nodiscard]] int gbsv(AB &&ab, int kl, int ku, IPIV &ipiv, B &&b) {
+    static_assert(std::is_same_v<get_value_t<AB>, get_value_t<B>>, "gbsv : the matrix and the right hand side must have the same element type");
+    static_assert(is_blas_lapack_v<get_value_t<AB>>, "gbsv : the matrix must have elements of type double or complex");
+    static_assert(std::is_same_v<get_value_t<IPIV>, int>, "gbsv : pivoting array must have elements of type int");
+    static_assert(std::decay_t<AB>::is_stride_order_Fortran(), "gbsv : the band storage must be in Fortran order");
+    static_assert(get_rank<B> == 1 or std::decay_t<B>::is_stride_order_Fortran(), "gbsv : B must be a vector or a matrix in Fortran order");
+    EXPECTS(ab.indexmap().min_stride() == 1);
+    EXPECTS(b.indexmap().min_stride() == 1);
+    EXPECTS(ab.extent(0) >= 2 * kl + ku + 1);
+
+    int n = ab.extent(1);
+    EXPECTS(b.extent(0) == n);
+    if (ipiv.size() < n) ipiv.resize(n);
+    int nrhs = 1, ldb = std::max(n, 1);
+    if constexpr (get_rank<B> == 2) {
+      nrhs = b.extent(1);
+      ldb  = get_ld(b);
+    }
+
+    int info = 0;
+    f77::gbsv(n, kl, ku, nrhs, ab.data(), get_ld(ab), ipiv.data(), b.data(), ldb, info);
+    return info;
+  }
+
+} // namespace nda::lapack
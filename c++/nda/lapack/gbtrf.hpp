@@ -0,0 +1,47 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * LU factorization of a n x n band matrix with kl sub-diagonals and ku super-diagonals, with partial pivoting.
+   *
+   * @param ab The band storage, a matrix of shape (2 * kl + ku + 1, n) in Fortran order, with unit smallest stride :
+   *           A(i, j) is ab(kl + ku + i - j, j). The first kl rows are workspace, filled by the factorization.
+   *           On return, ab contains the L and U factors.
+   * @param kl Number of sub-diagonals
+   * @param ku Number of super-diagonals
+   * @param ipiv The pivots, resized to n if necessary
+   */
+  template <MatrixView AB, ArrayOfRank<1> IPIV>
+  [[nodiscard]] int gbtrf(AB &&ab, int kl, int ku, IPIV &ipiv) {
+    static_assert(is_blas_lapack_v<get_value_t<AB>>, "gbtrf : the matrix must have elements of type double or complex");
+    static_assert(std::is_same_v<get_value_t<IPIV>, int>, "gbtrf : pivoting array must have elements of type int");
+    static_assert(std::decay_t<AB>::is_stride_order_Fortran(), "gbtrf : the band storage must be in Fortran order");
+    EXPECTS(ab.indexmap().min_stride() == 1);
+    EXPECTS(ab.extent(0) >= 2 * kl + ku + 1);
+
+    int n = ab.extent(1);
+    if (ipiv.size() < n) ipiv.resize(n);
+
+    int info = 0;
+    f77::gbtrf(n, n, kl, ku, ab.data(), get_ld(ab), ipiv.data(), info);
+    return info;
+  }
+
+} // namespace nda::lapack
@@ -0,0 +1,105 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Eigenvalues and, optionally, left and right eigenvectors of a general square matrix, with lapack geev :
+   *  A * vr_j = w_j * vr_j and vl_j^H * A = w_j * vl_j^H, the eigenvectors being normalized to unit norm.
+   *
+   * @param a The N x N matrix A, in Fortran order with unit smallest stride. It is destroyed by the operation.
+   * @param w The (complex) eigenvalues. Resized to N if necessary.
+   * @param vl The left eigenvectors as columns, a N x N matrix in Fortran order. Regular matrices are resized if necessary.
+   *           Not referenced for jobvl = 'N'.
+   *           For a real matrix, the complex eigenvectors come in conjugate pairs (w_{j+1} = conj(w_j), w_j having a positive imaginary part),
+   *           and are packed as in lapack : the columns j and j + 1 are the real and imaginary parts of the eigenvector of w_j.
+   * @param vr The right eigenvectors as columns, as vl. Not referenced for jobvr = 'N'.
+   * @param jobvl 'V' or 'N' : compute the left eigenvectors or not
+   * @param jobvr 'V' or 'N' : compute the right eigenvectors or not
+   * @param ws The workspace, reused from one call to the next
+   * @return The info returned by geev
+   */
+  template <MatrixView A, VectorView W, MatrixView VL, MatrixView VR>
+  int geev(A &&a, W &&w, VL &&vl, VR &&vr, char jobvl, char jobvr, eigen_workspace<get_value_t<A>> &ws) {
+    using T = get_value_t<A>;
+    using R = real_value_t<T>;
+    static_assert(is_blas_lapack_v<T>, "geev : the matrix must have elements of type double or complex");
+    static_assert(std::is_same_v<get_value_t<W>, std::complex<R>>, "geev : the eigenvalues must be complex, with the precision of the matrix");
+    static_assert(have_same_value_type_v<A, VL, VR>, "geev : the eigenvectors must have the element type of the matrix");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran() and std::decay_t<VL>::is_stride_order_Fortran()
+                     and std::decay_t<VR>::is_stride_order_Fortran(),
+                  "geev : C order not implemented");
+    EXPECTS(jobvl == 'V' or jobvl == 'N');
+    EXPECTS(jobvr == 'V' or jobvr == 'N');
+    EXPECTS(a.extent(0) == a.extent(1));
+    EXPECTS(a.indexmap().min_stride() == 1);
+
+    int n = a.extent(0);
+    auto resize_if_regular = [n](auto &x) {
+      if constexpr (is_regular_v<std::decay_t<decltype(x)>>) {
+        if (x.extent(0) != n or x.extent(1) != n) x.resize(n, n);
+      }
+      EXPECTS(x.extent(0) == n and x.extent(1) == n and x.indexmap().min_stride() == 1);
+    };
+    if constexpr (is_regular_v<std::decay_t<W>>) {
+      if (w.size() != n) w.resize(n);
+    }
+    EXPECTS(w.size() == n);
+    if (jobvl == 'V') resize_if_regular(vl);
+    if (jobvr == 'V') resize_if_regular(vr);
+    if (n == 0) return 0;
+    // lapack requires ldvl, ldvr >= 1 even when vl and vr are not referenced
+    int ldvl = std::max(1, get_ld(vl)), ldvr = std::max(1, get_ld(vr));
+
+    // The real and imaginary parts of the eigenvalues (real types), or rwork (complex types)
+    details::reserve_workspace(ws.rwork, 2 * n);
+    R *wri = ws.rwork.data();
+
+    auto call = [&](T *work, int lwork, int &info) {
+      if constexpr (is_complex_v<T>) {
+        EXPECTS(w.indexmap().min_stride() == 1);
+        f77::geev(jobvl, jobvr, n, a.data(), get_ld(a), w.data(), vl.data(), ldvl, vr.data(), ldvr, work, lwork, wri, info);
+      } else {
+        f77::geev(jobvl, jobvr, n, a.data(), get_ld(a), wri, wri + n, vl.data(), ldvl, vr.data(), ldvr, work, lwork, info);
+      }
+    };
+
+    // first call to get the optimal lwork
+    int info = 0;
+    T work1[1];
+    call(work1, -1, info);
+    int lwork = std::round(std::real(work1[0])) + 1;
+    details::reserve_workspace(ws.work, lwork);
+    call(ws.work.data(), lwork, info);
+
+    if constexpr (not is_complex_v<T>) {
+      for (int i = 0; i < n; ++i) w(i) = std::complex<R>{wri[i], wri[n + i]};
+    }
+
+    if (info < 0) NDA_RUNTIME_ERROR << "Error in geev : info = " << info;
+    return info;
+  }
+
+  /// geev with a workspace allocated for this call only, cf. above
+  template <MatrixView A, VectorView W, MatrixView VL, MatrixView VR>
+  int geev(A &&a, W &&w, VL &&vl, VR &&vr, char jobvl = 'N', char jobvr = 'V') {
+    auto ws = eigen_workspace<get_value_t<A>>{};
+    return geev(std::forward<A>(a), std::forward<W>(w), std::forward<VL>(vl), std::forward<VR>(vr), jobvl, jobvr, ws);
+  }
+
+} // namespace nda::lapack
@@ -18,7 +18,8 @@
 
 #include <optional>
 
-#include "./gesvd.hpp"
+#include "../blas/gemm.hpp"
+#include "./gesdd.hpp"
 
 namespace nda::lapack {
 
@@ -29,61 +30,102 @@ namespace nda::lapack {
     // Number of rows (M) and columns (N) of the Matrix A
     long M, N;
 
-    // The matrix to be decomposed by SVD
-    // FIXME Do we need to store it ? only use n_var
-    matrix<T> A;
-
-    // The (pseudo) inverse of A, i.e. V * Diag(S_vec)^{-1} * UT, for the least square procedure
-    matrix<T> V_x_InvS_x_UT;
+    // The thin SVD A = U1 * Diag(S_vec) * VT, U1 being M x N : the full M x M U is never computed.
+    // The solution is x = V * Diag(S_vec)^{-1} * U1^H * B
+    // and the part of B which is not fitted, B - U1 * U1^H * B, gives the error of the LLS.
+    matrix<T, F_layout> U1, UT1;
 
-    // The part of UT fixing the error of the LLS
-    matrix<T> UT_NULL;
+    // V * Diag(S_vec)^{-1}
+    matrix<T, F_layout> V_x_InvS;
 
     // Vector containing the singular values
     array<double, 1> s_vec;
 
     public:
-    int n_var() const { return A.extent(1); }
+    int n_var() const { return N; }
 
-    /// ???
-    // FIXME Looks it is not used
-    //matrix<T> const &A_mat() const { return A; }
-
-    /// ???
+    /// The singular values of A
     array<double, 1> const &S_vec() const { return s_vec; }
 
-    /// ???
-    gelss_worker(matrix_const_view<T> _A) : M(_A.extent(0)), N(_A.extent(1)), A(_A), s_vec(std::min(M, N)) {
+    /// Decompose A by a thin SVD (lapack gesdd), once for all the subsequent solves
+    gelss_worker(matrix_const_view<T> _A) : M(_A.extent(0)), N(_A.extent(1)), s_vec(std::min(M, N)) {
 
       if (N > M) NDA_RUNTIME_ERROR << "ERROR: Matrix A for linear least square procedure cannot have more columns than rows";
 
       matrix<T, F_layout> A_FL{_A};
-      matrix<T, F_layout> U(M, M);
       matrix<T, F_layout> VT(N, N);
+      U1.resize(M, N);
 
-      // Calculate the SVD A = U * Diag(S_vec) * VT
-      gesvd(A_FL, s_vec, U, VT);
+      // Calculate the thin SVD A = U1 * Diag(S_vec) * VT
+      gesdd(A_FL, s_vec, U1, VT, 'S');
 
-      // Calculate the matrix V * Diag(S_vec)^{-1} * UT for the least square procedure
-      matrix<double, F_layout> S_inv(N, M);
-      S_inv = 0.;
-      for (int i : range(std::min(M, N))) S_inv(i, i) = 1.0 / s_vec(i);
-      V_x_InvS_x_UT = dagger(VT) * S_inv * dagger(U);
+      UT1 = dagger(U1);
+      V_x_InvS.resize(N, N);
+      for (long j = 0; j < N; ++j)
+        for (long i = 0; i < N; ++i) V_x_InvS(i, j) = conj(VT(j, i)) / s_vec(j);
+    }
 
-      // Read off U_Null for defining the error of the least square procedure
-      if (N < M) UT_NULL = dagger(U)(range(N, M), range(M));
+    /// Shape of the workspace needed by solve for nrhs right hand sides
+    std::array<long, 2> workspace_shape(long nrhs) const { return {(M > N ? N + M : N), nrhs}; }
+
+    /**
+     * Solve the least-square problem that minimizes || A * x - B ||_2 given A and B, into caller-provided storage, without any allocation.
+     *
+     * The error estimate is max_j || B(:, j) - U1 * U1^H * B(:, j) ||_2 / sqrt(M), i.e. the norm of the part of the column
+     * outside the range of A. It is computed with one gemm into work and a column norm pass.
+     *
+     * @param B The right hand sides, of shape (M, nrhs)
+     * @param x The solution, of shape (N, nrhs)
+     * @param work Workspace of shape workspace_shape(nrhs), overwritten
+     * @return The error estimate
+     */
+    template <MemoryArrayOfRank<2> X, MemoryArrayOfRank<2> W>
+    double solve(matrix_const_view<T> B, X &&x, W &&work) const {
+      long nrhs = B.extent(1);
+      EXPECTS(B.extent(0) == M);
+      EXPECTS(x.shape() == (std::array<long, 2>{N, nrhs}));
+      EXPECTS(work.shape() == workspace_shape(nrhs));
+      if (nrhs == 0) return 0.0;
+
+      // c = U1^H * B, x = V * Diag(S_vec)^{-1} * c
+      auto c = work(range(0, N), range::all);
+      blas::gemm(T{1}, UT1, B, T{0}, c);
+      blas::gemm(T{1}, V_x_InvS, c, T{0}, x);
+      if (M == N) return 0.0;
+
+      // r = B - U1 * c
+      auto r = work(range(N, N + M), range::all);
+      r      = B;
+      blas::gemm(T{-1}, U1, c, T{1}, r);
+      double err2 = 0.0;
+      for (long j = 0; j < nrhs; ++j) {
+        double s = 0.0;
+        for (long i = 0; i < M; ++i) s += std::norm(r(i, j));
+        err2 = std::max(err2, s);
+      }
+      return std::sqrt(err2 / M);
+    }
+
+    /**
+     * Solve a batch of least-square problems || A * x(b, _, _) - B(b, _, _) ||_2, into caller-provided storage, without any allocation.
+     *
+     * @param B The right hand sides, of shape (n_batch, M, nrhs)
+     * @param x The solutions, of shape (n_batch, N, nrhs)
+     * @param errs The error estimates, of size n_batch
+     * @param work Workspace of shape workspace_shape(nrhs), overwritten
+     */
+    template <MemoryArrayOfRank<3> X, MemoryArrayOfRank<1> E, MemoryArrayOfRank<2> W>
+    void solve(array_const_view<T, 3> B, X &&x, E &&errs, W &&work) const {
+      EXPECTS(x.extent(0) == B.extent(0) and errs.extent(0) == B.extent(0));
+      for (long b = 0; b < B.extent(0); ++b) errs(b) = solve(B(b, range::all, range::all), x(b, range::all, range::all), work);
     }
 
     /// Solve the least-square problem that minimizes || A * x - B ||_2 given A and B
     std::pair<matrix<T>, double> operator()(matrix_const_view<T> B, std::optional<long> /*inner_matrix_dim*/ = {}) const {
-      using std::sqrt;
-      double err = 0.0;
-      if (M != N) {
-        std::vector<double> err_vec;
-        for (int i : range(B.shape()[1])) err_vec.push_back(frobenius_norm(UT_NULL * B(range(), range(i, i + 1))) / sqrt(B.shape()[0]));
-        err = *std::max_element(err_vec.begin(), err_vec.end());
-      }
-      return std::make_pair(V_x_InvS_x_UT * B, err);
+      auto x    = matrix<T>(N, B.extent(1));
+      auto work = matrix<T, F_layout>(workspace_shape(B.extent(1)));
+      double err = solve(B, x, work);
+      return std::make_pair(std::move(x), err);
     }
   };
 
@@ -0,0 +1,72 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * QR factorization with column pivoting A * P = Q * R of a M x N matrix (lapack geqp3).
+   *
+   * The columns are permuted so that the diagonal of R has decreasing magnitudes, which reveals the numerical rank
+   * of A and selects its most linearly independent columns (e.g. for interpolative decompositions).
+   * On return, a is as for geqrf : R in its upper trapezoid and the reflectors, to be used with orgqr, below.
+   *
+   * @param a The matrix, in Fortran order with unit smallest stride. Overwritten by R and the reflectors.
+   * @param jpvt The permutation, of size N, 1-based as in lapack : column j of A * P is column jpvt(j) - 1 of A.
+   *             On entry, the columns with jpvt(j) != 0 are moved to the front and are not pivoted.
+   *             Set jpvt to 0 for a free pivoting of all the columns.
+   * @param tau The scalar factors of the reflectors. Resized to min(M, N) if necessary.
+   * @return The info returned by geqp3
+   */
+  template <MatrixView A, VectorView JPVT, VectorView TAU>
+  int geqp3(A &&a, JPVT &&jpvt, TAU &&tau) {
+    using T = get_value_t<A>;
+    static_assert(is_blas_lapack_v<T>, "geqp3 : the matrix must have elements of type double or complex");
+    static_assert(have_same_value_type_v<A, TAU>, "geqp3 : tau must have the element type of the matrix");
+    static_assert(std::is_same_v<get_value_t<JPVT>, int>, "geqp3 : jpvt must be an array of int");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran(), "geqp3 : C order not implemented");
+    EXPECTS(a.indexmap().min_stride() == 1);
+
+    int m = a.extent(0), n = a.extent(1), k = std::min(m, n);
+    if constexpr (is_regular_v<std::decay_t<TAU>>) {
+      if (tau.size() != k) tau.resize(k);
+    }
+    EXPECTS(tau.size() == k and jpvt.size() == n);
+    if (k == 0) return 0;
+    EXPECTS(tau.indexmap().min_stride() == 1 and jpvt.indexmap().min_stride() == 1);
+
+    // first call to get the optimal lwork
+    int info = 0;
+    T work1[1];
+    if constexpr (is_complex_v<T>) {
+      array<real_value_t<T>, 1> rwork(2 * n);
+      f77::geqp3(m, n, a.data(), get_ld(a), jpvt.data(), tau.data(), work1, -1, rwork.data(), info);
+      int lwork = std::round(std::real(work1[0])) + 1;
+      array<T, 1> work(lwork);
+      f77::geqp3(m, n, a.data(), get_ld(a), jpvt.data(), tau.data(), work.data(), lwork, rwork.data(), info);
+    } else {
+      f77::geqp3(m, n, a.data(), get_ld(a), jpvt.data(), tau.data(), work1, -1, info);
+      int lwork = std::round(work1[0]) + 1;
+      array<T, 1> work(lwork);
+      f77::geqp3(m, n, a.data(), get_ld(a), jpvt.data(), tau.data(), work.data(), lwork, info);
+    }
+
+    if (info) NDA_RUNTIME_ERROR << "Error in geqp3 : info = " << info;
+    return info;
+  }
+
+} // namespace nda::lapack
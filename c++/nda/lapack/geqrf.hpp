@@ -0,0 +1,59 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * QR factorization A = Q * R of a M x N matrix, with Householder reflectors (lapack geqrf).
+   *
+   * On return, R is in the upper triangle (trapezoid) of a, and Q is represented by the K = min(M, N) reflectors
+   * stored below the diagonal of a, together with tau. Q is obtained with orgqr.
+   *
+   * @param a The matrix, in Fortran order with unit smallest stride. Overwritten by R and the reflectors.
+   * @param tau The scalar factors of the reflectors. Resized to K if necessary.
+   * @return The info returned by geqrf
+   */
+  template <MatrixView A, VectorView TAU>
+  int geqrf(A &&a, TAU &&tau) {
+    using T = get_value_t<A>;
+    static_assert(is_blas_lapack_v<T>, "geqrf : the matrix must have elements of type double or complex");
+    static_assert(have_same_value_type_v<A, TAU>, "geqrf : tau must have the element type of the matrix");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran(), "geqrf : C order not implemented");
+    EXPECTS(a.indexmap().min_stride() == 1);
+
+    int m = a.extent(0), n = a.extent(1), k = std::min(m, n);
+    if constexpr (is_regular_v<std::decay_t<TAU>>) {
+      if (tau.size() != k) tau.resize(k);
+    }
+    EXPECTS(tau.size() == k);
+    if (k == 0) return 0;
+    EXPECTS(tau.indexmap().min_stride() == 1);
+
+    // first call to get the optimal lwork
+    int info = 0;
+    T work1[1];
+    f77::geqrf(m, n, a.data(), get_ld(a), tau.data(), work1, -1, info);
+    int lwork = std::round(std::real(work1[0])) + 1;
+    array<T, 1> work(lwork);
+    f77::geqrf(m, n, a.data(), get_ld(a), tau.data(), work.data(), lwork, info);
+
+    if (info) NDA_RUNTIME_ERROR << "Error in geqrf : info = " << info;
+    return info;
+  }
+
+} // namespace nda::lapack
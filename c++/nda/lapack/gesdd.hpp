@@ -0,0 +1,90 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Singular value decomposition A = U * diag(S) * VT, by the divide and conquer algorithm of lapack gesdd,
+   * much faster than gesvd for large matrices when the singular vectors are needed.
+   *
+   * @param a The matrix A, of shape (M, N), in Fortran order with unit smallest stride. It is destroyed by the operation.
+   * @param s The singular values, in descending order. Resized to K = min(M, N) if necessary.
+   * @param u The left singular vectors as columns, in Fortran order : (M, M) for jobz = 'A', (M, K) for jobz = 'S'.
+   *          Regular matrices are resized if necessary. Not referenced for jobz = 'N'.
+   * @param vt The right singular vectors as rows, in Fortran order : (N, N) for jobz = 'A', (K, N) for jobz = 'S'.
+   *          Regular matrices are resized if necessary. Not referenced for jobz = 'N'.
+   * @param jobz 'A' (full SVD), 'S' (thin SVD, skipping the columns of U and the rows of VT beyond K) or 'N' (singular values only)
+   * @return The info returned by gesdd
+   */
+  template <MatrixView A, VectorView S, MatrixView U, MatrixView VT>
+  int gesdd(A &&a, S &&s, U &&u, VT &&vt, char jobz = 'S') {
+    using T = get_value_t<A>;
+    static_assert(is_blas_lapack_v<T>, "gesdd : the matrix must have elements of type double or complex");
+    static_assert(std::is_same_v<get_value_t<S>, real_value_t<T>>, "gesdd : the singular values must be real, with the precision of the matrix");
+    static_assert(have_same_value_type_v<A, U, VT>, "gesdd : the singular vectors must have the element type of the matrix");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran() and std::decay_t<U>::is_stride_order_Fortran()
+                     and std::decay_t<VT>::is_stride_order_Fortran(),
+                  "gesdd : C order not implemented");
+    EXPECTS(jobz == 'A' or jobz == 'S' or jobz == 'N');
+    EXPECTS(a.indexmap().min_stride() == 1);
+
+    int m = a.extent(0), n = a.extent(1), k = std::min(m, n);
+    auto resize_if_regular = [](auto &x, long n0, long n1) {
+      if constexpr (is_regular_v<std::decay_t<decltype(x)>>) {
+        if (x.extent(0) != n0 or x.extent(1) != n1) x.resize(n0, n1);
+      }
+      EXPECTS(x.extent(0) == n0 and x.extent(1) == n1 and x.indexmap().min_stride() == 1);
+    };
+    if constexpr (is_regular_v<std::decay_t<S>>) {
+      if (s.size() != k) s.resize(k);
+    }
+    EXPECTS(s.size() == k and s.indexmap().min_stride() == 1);
+    if (jobz != 'N') {
+      resize_if_regular(u, m, (jobz == 'A' ? m : k));
+      resize_if_regular(vt, (jobz == 'A' ? n : k), n);
+    }
+    if (k == 0) return 0;
+    // lapack requires ldu, ldvt >= 1 even when u and vt are not referenced
+    int ldu = std::max(1, get_ld(u)), ldvt = std::max(1, get_ld(vt));
+
+    int info = 0;
+    array<int, 1> iwork(8 * k);
+    if constexpr (is_complex_v<T>) {
+      long lrwork = (jobz == 'N' ? 7l * k : k * std::max(5l * k + 7, 2l * std::max(m, n) + 2l * k + 1));
+      array<real_value_t<T>, 1> rwork(lrwork);
+
+      // first call to get the optimal lwork
+      T work1[1];
+      f77::gesdd(jobz, m, n, a.data(), get_ld(a), s.data(), u.data(), ldu, vt.data(), ldvt, work1, -1, rwork.data(), iwork.data(), info);
+      int lwork = std::round(std::real(work1[0])) + 1;
+      array<T, 1> work(lwork);
+      f77::gesdd(jobz, m, n, a.data(), get_ld(a), s.data(), u.data(), ldu, vt.data(), ldvt, work.data(), lwork, rwork.data(), iwork.data(), info);
+    } else {
+      // first call to get the optimal lwork
+      T work1[1];
+      f77::gesdd(jobz, m, n, a.data(), get_ld(a), s.data(), u.data(), ldu, vt.data(), ldvt, work1, -1, iwork.data(), info);
+      int lwork = std::round(work1[0]) + 1;
+      array<T, 1> work(lwork);
+      f77::gesdd(jobz, m, n, a.data(), get_ld(a), s.data(), u.data(), ldu, vt.data(), ldvt, work.data(), lwork, iwork.data(), info);
+    }
+
+    if (info) NDA_RUNTIME_ERROR << "Error in gesdd : info = " << info;
+    return info;
+  }
+
+} // namespace nda::lapack
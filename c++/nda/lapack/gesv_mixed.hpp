@@ -0,0 +1,70 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Mixed precision solve of A * X = B, using lapack dsgesv (double) or zcgesv (dcomplex).
+   *
+   * A is LU factorized in single precision, and the solution is then iteratively refined
+   * in double precision, which halves the memory traffic of the factorization.
+   * If the refinement does not converge, lapack falls back to a double precision factorization.
+   *
+   * @tparam A Matrix of shape (N,N) in Fortran order, with unit smallest stride.
+   *         It is unchanged, unless the fallback is used, in which case it contains the double precision LU factors.
+   * @tparam B Matrix of shape (N,NRHS) in Fortran order, with unit smallest stride
+   * @tparam X Matrix of shape (N,NRHS) in Fortran order, with unit smallest stride. Receives the solution.
+   * @param iter The number of refinement iterations, or a negative value if the fallback was used (cf lapack doc)
+   * @return info, cf lapack doc
+   */
+  template <MatrixView A, MatrixView B, MatrixView X>
+  requires(have_same_value_type_v<A, B, X>)
+  [[nodiscard]] int gesv_mixed(A &&a, B const &b, X &&x, int &iter) {
+    using T = get_value_t<A>;
+    static_assert(std::is_same_v<T, double> or std::is_same_v<T, dcomplex>, "gesv_mixed : element type must be double or dcomplex");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran(), "gesv_mixed : C order not implemented");
+    static_assert(std::decay_t<B>::is_stride_order_Fortran(), "gesv_mixed : C order not implemented");
+    static_assert(std::decay_t<X>::is_stride_order_Fortran(), "gesv_mixed : C order not implemented");
+
+    EXPECTS(a.extent(0) == a.extent(1));
+    EXPECTS(b.extent(0) == a.extent(0));
+    EXPECTS(x.shape() == b.shape());
+    EXPECTS(a.indexmap().min_stride() == 1);
+    EXPECTS(b.indexmap().min_stride() == 1);
+    EXPECTS(x.indexmap().min_stride() == 1);
+
+    int n    = a.extent(0);
+    int nrhs = b.extent(1);
+    int info = 0;
+
+    array<int, 1> ipiv(n);
+    array<T, 1> work(n * nrhs);
+    array<std::complex<float>, 1> swork_c(is_complex_v<T> ? n * (n + nrhs) : 0);
+    array<float, 1> swork(is_complex_v<T> ? 0 : n * (n + nrhs));
+
+    if constexpr (is_complex_v<T>) {
+      array<double, 1> rwork(n);
+      f77::gesv_mixed(n, nrhs, a.data(), get_ld(a), ipiv.data(), b.data(), get_ld(b), x.data(), get_ld(x), work.data(), swork_c.data(), rwork.data(),
+                      iter, info);
+    } else {
+      f77::gesv_mixed(n, nrhs, a.data(), get_ld(a), ipiv.data(), b.data(), get_ld(b), x.data(), get_ld(x), work.data(), swork.data(), iter, info);
+    }
+    return info;
+  }
+
+} // namespace nda::lapack
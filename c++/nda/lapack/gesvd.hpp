@@ -21,11 +21,13 @@ namespace nda::lapack {
   ///
   ///  $$ A = U S {}^t V$$
   /// A is destroyed during the computation
+  /// job : 'A' for the full U (M x M) and V (N x N), 'S' for the thin U (M x K) and V (K x N), K = min(M, N),
+  ///       'N' for the singular values only (u and v are not referenced). For large matrices, cf. gesdd.
   template <MatrixView A, MatrixView U, MatrixView V>
 
   requires(have_same_value_type_v<A, U, V> and is_blas_lapack_v<typename A::value_type>)
 
-  int gesvd1(A &a, array_view<double, 1> c, U &u, V &v) {
+  int gesvd1(A &a, array_view<real_value_t<typename A::value_type>, 1> c, U &u, V &v, char job = 'A') {
 
     static_assert(A::layout_t::is_stride_order_Fortran(), "C order not implemented");
     static_assert(U::layout_t::is_stride_order_Fortran(), "C order not implemented");
@@ -36,32 +38,41 @@ namespace nda::lapack {
     using T = typename A::value_type;
     static_assert(is_blas_lapack_v<T>, "Not implemented");
 
-    if constexpr (std::is_same_v<T, double>) {
+    EXPECTS(job == 'A' or job == 'S' or job == 'N');
+    long m = a.extent(0), n = a.extent(1), k = std::min(m, n);
+    EXPECTS(c.size() >= k);
+    if (job != 'N') {
+      EXPECTS(u.extent(0) == m and u.extent(1) == (job == 'A' ? m : k));
+      EXPECTS(v.extent(0) == (job == 'A' ? n : k) and v.extent(1) == n);
+    }
+    // lapack requires ldu, ldvt >= 1 even when u and v are not referenced
+    int ldu = std::max(1, get_ld(u)), ldv = std::max(1, get_ld(v));
+
+    if constexpr (not is_complex_v<T>) {
 
       // first call to get the optimal lwork
       T work1[1];
-      lapack::f77::gesvd('A', 'A', get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), get_ld(u), v.data(), get_ld(v), work1, -1,
-                         info);
+      lapack::f77::gesvd(job, job, get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), ldu, v.data(), ldv, work1, -1, info);
 
       int lwork = std::round(work1[0]) + 1;
       array<T, 1> work(lwork);
 
-      lapack::f77::gesvd('A', 'A', get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), get_ld(u), v.data(), get_ld(v), work.data(),
-                         lwork, info);
+      lapack::f77::gesvd(job, job, get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), ldu, v.data(), ldv, work.data(), lwork,
+                         info);
 
     } else {
 
-      auto rwork = array<double, 1>(5 * std::min(a.extent(0), a.extent(1)));
+      auto rwork = array<real_value_t<T>, 1>(5 * std::min(a.extent(0), a.extent(1)));
 
       // first call to get the optimal lwork
       T work1[1];
-      lapack::f77::gesvd('A', 'A', get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), get_ld(u), v.data(), get_ld(v), work1, -1,
+      lapack::f77::gesvd(job, job, get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), ldu, v.data(), ldv, work1, -1,
                          rwork.data(), info);
 
       int lwork = std::round(std::real(work1[0])) + 1;
       array<T, 1> work(lwork);
 
-      lapack::f77::gesvd('A', 'A', get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), get_ld(u), v.data(), get_ld(v), work.data(),
+      lapack::f77::gesvd(job, job, get_n_rows(a), get_n_cols(a), a.data(), get_ld(a), c.data(), u.data(), ldu, v.data(), ldv, work.data(),
                          lwork, rwork.data(), info);
     }
 
@@ -69,12 +80,24 @@ namespace nda::lapack {
     return info;
   }
 
-  inline int gesvd(matrix_view<double, F_layout> a, array_view<double, 1> c, matrix_view<double, F_layout> u, matrix_view<double, F_layout> v) {
-    return gesvd1(a, c, u, v);
+  inline int gesvd(matrix_view<double, F_layout> a, array_view<double, 1> c, matrix_view<double, F_layout> u, matrix_view<double, F_layout> v,
+                   char job = 'A') {
+    return gesvd1(a, c, u, v, job);
+  }
+
+  inline int gesvd(matrix_view<dcomplex, F_layout> a, array_view<double, 1> c, matrix_view<dcomplex, F_layout> u, matrix_view<dcomplex, F_layout> v,
+                   char job = 'A') {
+    return gesvd1(a, c, u, v, job);
+  }
+
+  inline int gesvd(matrix_view<float, F_layout> a, array_view<float, 1> c, matrix_view<float, F_layout> u, matrix_view<float, F_layout> v,
+                   char job = 'A') {
+    return gesvd1(a, c, u, v, job);
   }
 
-  inline int gesvd(matrix_view<dcomplex, F_layout> a, array_view<double, 1> c, matrix_view<dcomplex, F_layout> u, matrix_view<dcomplex, F_layout> v) {
-    return gesvd1(a, c, u, v);
+  inline int gesvd(matrix_view<std::complex<float>, F_layout> a, array_view<float, 1> c, matrix_view<std::complex<float>, F_layout> u,
+                   matrix_view<std::complex<float>, F_layout> v, char job = 'A') {
+    return gesvd1(a, c, u, v, job);
   }
 
 } // namespace nda::lapack
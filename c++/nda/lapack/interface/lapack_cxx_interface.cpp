@@ -4,6 +4,79 @@
 
 namespace nda::lapack::f77 {
 
+  void gbsv(int N, int KL, int KU, int NRHS, double *AB, int LDAB, int *ipiv, double *B, int LDB, int &info) {
+    LAPACK_dgbsv(&N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+  void gbsv(int N, int KL, int KU, int NRHS, std::complex<double> *AB, int LDAB, int *ipiv, std::complex<double> *B, int LDB, int &info) {
+    LAPACK_zgbsv(&N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+  void gbsv(int N, int KL, int KU, int NRHS, float *AB, int LDAB, int *ipiv, float *B, int LDB, int &info) {
+    LAPACK_sgbsv(&N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+  void gbsv(int N, int KL, int KU, int NRHS, std::complex<float> *AB, int LDAB, int *ipiv, std::complex<float> *B, int LDB, int &info) {
+    LAPACK_cgbsv(&N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+
+  void gbtrf(int M, int N, int KL, int KU, double *AB, int LDAB, int *ipiv, int &info) {
+    LAPACK_dgbtrf(&M, &N, &KL, &KU, AB, &LDAB, ipiv, &info);
+  }
+  void gbtrf(int M, int N, int KL, int KU, std::complex<double> *AB, int LDAB, int *ipiv, int &info) {
+    LAPACK_zgbtrf(&M, &N, &KL, &KU, AB, &LDAB, ipiv, &info);
+  }
+  void gbtrf(int M, int N, int KL, int KU, float *AB, int LDAB, int *ipiv, int &info) {
+    LAPACK_sgbtrf(&M, &N, &KL, &KU, AB, &LDAB, ipiv, &info);
+  }
+  void gbtrf(int M, int N, int KL, int KU, std::complex<float> *AB, int LDAB, int *ipiv, int &info) {
+    LAPACK_cgbtrf(&M, &N, &KL, &KU, AB, &LDAB, ipiv, &info);
+  }
+
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, double const *AB, int LDAB, int const *ipiv, double *B, int LDB, int &info) {
+    LAPACK_dgbtrs(&TRANS, &N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, std::complex<double> const *AB, int LDAB, int const *ipiv, std::complex<double> *B, int LDB,
+             int &info) {
+    LAPACK_zgbtrs(&TRANS, &N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, float const *AB, int LDAB, int const *ipiv, float *B, int LDB, int &info) {
+    LAPACK_sgbtrs(&TRANS, &N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, std::complex<float> const *AB, int LDAB, int const *ipiv, std::complex<float> *B, int LDB,
+             int &info) {
+    LAPACK_cgbtrs(&TRANS, &N, &KL, &KU, &NRHS, AB, &LDAB, ipiv, B, &LDB, &info);
+  }
+
+  void gecon(char NORM, int N, double const *A, int LDA, double ANORM, double &RCOND, double *WORK, int *IWORK, int &INFO) {
+    LAPACK_dgecon(&NORM, &N, A, &LDA, &ANORM, &RCOND, WORK, IWORK, &INFO);
+  }
+  void gecon(char NORM, int N, std::complex<double> const *A, int LDA, double ANORM, double &RCOND, std::complex<double> *WORK, double *RWORK,
+             int &INFO) {
+    LAPACK_zgecon(&NORM, &N, A, &LDA, &ANORM, &RCOND, WORK, RWORK, &INFO);
+  }
+  void gecon(char NORM, int N, float const *A, int LDA, float ANORM, float &RCOND, float *WORK, int *IWORK, int &INFO) {
+    LAPACK_sgecon(&NORM, &N, A, &LDA, &ANORM, &RCOND, WORK, IWORK, &INFO);
+  }
+  void gecon(char NORM, int N, std::complex<float> const *A, int LDA, float ANORM, float &RCOND, std::complex<float> *WORK, float *RWORK,
+             int &INFO) {
+    LAPACK_cgecon(&NORM, &N, A, &LDA, &ANORM, &RCOND, WORK, RWORK, &INFO);
+  }
+
+  void geev(char JOBVL, char JOBVR, int N, double *A, int LDA, double *WR, double *WI, double *VL, int LDVL, double *VR, int LDVR, double *WORK,
+            int LWORK, int &INFO) {
+    LAPACK_dgeev(&JOBVL, &JOBVR, &N, A, &LDA, WR, WI, VL, &LDVL, VR, &LDVR, WORK, &LWORK, &INFO);
+  }
+  void geev(char JOBVL, char JOBVR, int N, std::complex<double> *A, int LDA, std::complex<double> *W, std::complex<double> *VL, int LDVL,
+            std::complex<double> *VR, int LDVR, std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO) {
+    LAPACK_zgeev(&JOBVL, &JOBVR, &N, A, &LDA, W, VL, &LDVL, VR, &LDVR, WORK, &LWORK, RWORK, &INFO);
+  }
+  void geev(char JOBVL, char JOBVR, int N, float *A, int LDA, float *WR, float *WI, float *VL, int LDVL, float *VR, int LDVR, float *WORK, int LWORK,
+            int &INFO) {
+    LAPACK_sgeev(&JOBVL, &JOBVR, &N, A, &LDA, WR, WI, VL, &LDVL, VR, &LDVR, WORK, &LWORK, &INFO);
+  }
+  void geev(char JOBVL, char JOBVR, int N, std::complex<float> *A, int LDA, std::complex<float> *W, std::complex<float> *VL, int LDVL,
+            std::complex<float> *VR, int LDVR, std::complex<float> *WORK, int LWORK, float *RWORK, int &INFO) {
+    LAPACK_cgeev(&JOBVL, &JOBVR, &N, A, &LDA, W, VL, &LDVL, VR, &LDVR, WORK, &LWORK, RWORK, &INFO);
+  }
+
   void gelss(int M, int N, int NRHS, double *A, int LDA, double *B, int LDB, double *S, double RCOND, int &RANK, double *WORK, int LWORK, int &INFO) {
     LAPACK_dgelss(&M, &N, &NRHS, A, &LDA, B, &LDB, S, &RCOND, &RANK, WORK, &LWORK, &INFO);
   }
@@ -11,6 +84,58 @@ namespace nda::lapack::f77 {
              std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO) {
     LAPACK_zgelss(&M, &N, &NRHS, A, &LDA, B, &LDB, S, &RCOND, &RANK, WORK, &LWORK, RWORK, &INFO);
   }
+  void gelss(int M, int N, int NRHS, float *A, int LDA, float *B, int LDB, float *S, float RCOND, int &RANK, float *WORK, int LWORK, int &INFO) {
+    LAPACK_sgelss(&M, &N, &NRHS, A, &LDA, B, &LDB, S, &RCOND, &RANK, WORK, &LWORK, &INFO);
+  }
+  void gelss(int M, int N, int NRHS, std::complex<float> *A, int LDA, std::complex<float> *B, int LDB, float *S, float RCOND, int &RANK,
+             std::complex<float> *WORK, int LWORK, float *RWORK, int &INFO) {
+    LAPACK_cgelss(&M, &N, &NRHS, A, &LDA, B, &LDB, S, &RCOND, &RANK, WORK, &LWORK, RWORK, &INFO);
+  }
+
+  void geqp3(int M, int N, double *A, int LDA, int *JPVT, double *TAU, double *WORK, int LWORK, int &INFO) {
+    LAPACK_dgeqp3(&M, &N, A, &LDA, JPVT, TAU, WORK, &LWORK, &INFO);
+  }
+  void geqp3(int M, int N, std::complex<double> *A, int LDA, int *JPVT, std::complex<double> *TAU, std::complex<double> *WORK,
+             int LWORK, double *RWORK, int &INFO) {
+    LAPACK_zgeqp3(&M, &N, A, &LDA, JPVT, TAU, WORK, &LWORK, RWORK, &INFO);
+  }
+  void geqp3(int M, int N, float *A, int LDA, int *JPVT, float *TAU, float *WORK, int LWORK, int &INFO) {
+    LAPACK_sgeqp3(&M, &N, A, &LDA, JPVT, TAU, WORK, &LWORK, &INFO);
+  }
+  void geqp3(int M, int N, std::complex<float> *A, int LDA, int *JPVT, std::complex<float> *TAU, std::complex<float> *WORK,
+             int LWORK, float *RWORK, int &INFO) {
+    LAPACK_cgeqp3(&M, &N, A, &LDA, JPVT, TAU, WORK, &LWORK, RWORK, &INFO);
+  }
+
+  void geqrf(int M, int N, double *A, int LDA, double *TAU, double *WORK, int LWORK, int &INFO) {
+    LAPACK_dgeqrf(&M, &N, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+  void geqrf(int M, int N, std::complex<double> *A, int LDA, std::complex<double> *TAU, std::complex<double> *WORK, int LWORK, int &INFO) {
+    LAPACK_zgeqrf(&M, &N, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+  void geqrf(int M, int N, float *A, int LDA, float *TAU, float *WORK, int LWORK, int &INFO) {
+    LAPACK_sgeqrf(&M, &N, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+  void geqrf(int M, int N, std::complex<float> *A, int LDA, std::complex<float> *TAU, std::complex<float> *WORK, int LWORK, int &INFO) {
+    LAPACK_cgeqrf(&M, &N, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+
+  void gesdd(char JOBZ, int M, int N, double *A, int LDA, double *S, double *U, int LDU, double *VT, int LDVT, double *WORK, int LWORK, int *IWORK,
+             int &INFO) {
+    LAPACK_dgesdd(&JOBZ, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, IWORK, &INFO);
+  }
+  void gesdd(char JOBZ, int M, int N, std::complex<double> *A, int LDA, double *S, std::complex<double> *U, int LDU, std::complex<double> *VT,
+             int LDVT, std::complex<double> *WORK, int LWORK, double *RWORK, int *IWORK, int &INFO) {
+    LAPACK_zgesdd(&JOBZ, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, RWORK, IWORK, &INFO);
+  }
+  void gesdd(char JOBZ, int M, int N, float *A, int LDA, float *S, float *U, int LDU, float *VT, int LDVT, float *WORK, int LWORK, int *IWORK,
+             int &INFO) {
+    LAPACK_sgesdd(&JOBZ, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, IWORK, &INFO);
+  }
+  void gesdd(char JOBZ, int M, int N, std::complex<float> *A, int LDA, float *S, std::complex<float> *U, int LDU, std::complex<float> *VT, int LDVT,
+             std::complex<float> *WORK, int LWORK, float *RWORK, int *IWORK, int &INFO) {
+    LAPACK_cgesdd(&JOBZ, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, RWORK, IWORK, &INFO);
+  }
 
   void gesvd(const char &JOBU, const char &JOBVT, int M, int N, double *A, int LDA, double *S, double *U, int LDU, double *VT, int LDVT, double *WORK,
              int LWORK, int &INFO) {
@@ -20,37 +145,177 @@ namespace nda::lapack::f77 {
              std::complex<double> *VT, int LDVT, std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO) {
     LAPACK_zgesvd(&JOBU, &JOBVT, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, RWORK, &INFO);
   }
+  void gesvd(const char &JOBU, const char &JOBVT, int M, int N, float *A, int LDA, float *S, float *U, int LDU, float *VT, int LDVT, float *WORK,
+             int LWORK, int &INFO) {
+    LAPACK_sgesvd(&JOBU, &JOBVT, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, &INFO);
+  }
+  void gesvd(const char &JOBU, const char &JOBVT, int M, int N, std::complex<float> *A, int LDA, float *S, std::complex<float> *U, int LDU,
+             std::complex<float> *VT, int LDVT, std::complex<float> *WORK, int LWORK, float *RWORK, int &INFO) {
+    LAPACK_cgesvd(&JOBU, &JOBVT, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, RWORK, &INFO);
+  }
 
   void getrf(int M, int N, double *A, int LDA, int *ipiv, int &info) { LAPACK_dgetrf(&M, &N, A, &LDA, ipiv, &info); }
   void getrf(int M, int N, std::complex<double> *A, int LDA, int *ipiv, int &info) { LAPACK_zgetrf(&M, &N, A, &LDA, ipiv, &info); }
+  void getrf(int M, int N, float *A, int LDA, int *ipiv, int &info) { LAPACK_sgetrf(&M, &N, A, &LDA, ipiv, &info); }
+  void getrf(int M, int N, std::complex<float> *A, int LDA, int *ipiv, int &info) { LAPACK_cgetrf(&M, &N, A, &LDA, ipiv, &info); }
 
   void getri(int N, double *A, int LDA, int *ipiv, double *work, int lwork, int &info) { LAPACK_dgetri(&N, A, &LDA, ipiv, work, &lwork, &info); }
   void getri(int N, std::complex<double> *A, int LDA, int *ipiv, std::complex<double> *work, int lwork, int &info) {
     LAPACK_zgetri(&N, A, &LDA, ipiv, work, &lwork, &info);
   }
+  void getri(int N, float *A, int LDA, int *ipiv, float *work, int lwork, int &info) { LAPACK_sgetri(&N, A, &LDA, ipiv, work, &lwork, &info); }
+  void getri(int N, std::complex<float> *A, int LDA, int *ipiv, std::complex<float> *work, int lwork, int &info) {
+    LAPACK_cgetri(&N, A, &LDA, ipiv, work, &lwork, &info);
+  }
+
+  void gesv_mixed(int N, int NRHS, double *A, int LDA, int *ipiv, double const *B, int LDB, double *X, int LDX, double *work, float *swork, int &iter,
+                  int &info) {
+    LAPACK_dsgesv(&N, &NRHS, A, &LDA, ipiv, B, &LDB, X, &LDX, work, swork, &iter, &info);
+  }
+  void gesv_mixed(int N, int NRHS, std::complex<double> *A, int LDA, int *ipiv, std::complex<double> const *B, int LDB, std::complex<double> *X,
+                  int LDX, std::complex<double> *work, std::complex<float> *swork, double *rwork, int &iter, int &info) {
+    LAPACK_zcgesv(&N, &NRHS, A, &LDA, ipiv, B, &LDB, X, &LDX, work, swork, rwork, &iter, &info);
+  }
 
   void gtsv(int N, int NRHS, double *DL, double *D, double *DU, double *B, int LDB, int &info) { LAPACK_dgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info); }
   void gtsv(int N, int NRHS, std::complex<double> *DL, std::complex<double> *D, std::complex<double> *DU, std::complex<double> *B, int LDB,
             int &info) {
     LAPACK_zgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info);
   }
+  void gtsv(int N, int NRHS, float *DL, float *D, float *DU, float *B, int LDB, int &info) { LAPACK_sgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info); }
+  void gtsv(int N, int NRHS, std::complex<float> *DL, std::complex<float> *D, std::complex<float> *DU, std::complex<float> *B, int LDB,
+            int &info) {
+    LAPACK_cgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info);
+  }
+
+  double lange(char NORM, int M, int N, double const *A, int LDA, double *WORK) { return LAPACK_dlange(&NORM, &M, &N, A, &LDA, WORK); }
+  double lange(char NORM, int M, int N, std::complex<double> const *A, int LDA, double *WORK) {
+    return LAPACK_zlange(&NORM, &M, &N, A, &LDA, WORK);
+  }
+  float lange(char NORM, int M, int N, float const *A, int LDA, float *WORK) { return LAPACK_slange(&NORM, &M, &N, A, &LDA, WORK); }
+  float lange(char NORM, int M, int N, std::complex<float> const *A, int LDA, float *WORK) {
+    return LAPACK_clange(&NORM, &M, &N, A, &LDA, WORK);
+  }
+
+  void orgqr(int M, int N, int K, double *A, int LDA, double const *TAU, double *WORK, int LWORK, int &INFO) {
+    LAPACK_dorgqr(&M, &N, &K, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+  void ungqr(int M, int N, int K, std::complex<double> *A, int LDA, std::complex<double> const *TAU, std::complex<double> *WORK, int LWORK,
+             int &INFO) {
+    LAPACK_zungqr(&M, &N, &K, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+  void orgqr(int M, int N, int K, float *A, int LDA, float const *TAU, float *WORK, int LWORK, int &INFO) {
+    LAPACK_sorgqr(&M, &N, &K, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+  void ungqr(int M, int N, int K, std::complex<float> *A, int LDA, std::complex<float> const *TAU, std::complex<float> *WORK, int LWORK, int &INFO) {
+    LAPACK_cungqr(&M, &N, &K, A, &LDA, TAU, WORK, &LWORK, &INFO);
+  }
+
+  void potrf(char UPLO, int N, double *A, int LDA, int &info) { LAPACK_dpotrf(&UPLO, &N, A, &LDA, &info); }
+  void potrf(char UPLO, int N, std::complex<double> *A, int LDA, int &info) { LAPACK_zpotrf(&UPLO, &N, A, &LDA, &info); }
+  void potrf(char UPLO, int N, float *A, int LDA, int &info) { LAPACK_spotrf(&UPLO, &N, A, &LDA, &info); }
+  void potrf(char UPLO, int N, std::complex<float> *A, int LDA, int &info) { LAPACK_cpotrf(&UPLO, &N, A, &LDA, &info); }
+
+  void potri(char UPLO, int N, double *A, int LDA, int &info) { LAPACK_dpotri(&UPLO, &N, A, &LDA, &info); }
+  void potri(char UPLO, int N, std::complex<double> *A, int LDA, int &info) { LAPACK_zpotri(&UPLO, &N, A, &LDA, &info); }
+  void potri(char UPLO, int N, float *A, int LDA, int &info) { LAPACK_spotri(&UPLO, &N, A, &LDA, &info); }
+  void potri(char UPLO, int N, std::complex<float> *A, int LDA, int &info) { LAPACK_cpotri(&UPLO, &N, A, &LDA, &info); }
+
+  void potrs(char UPLO, int N, int NRHS, double const *A, int LDA, double *B, int LDB, int &info) {
+    LAPACK_dpotrs(&UPLO, &N, &NRHS, A, &LDA, B, &LDB, &info);
+  }
+  void potrs(char UPLO, int N, int NRHS, std::complex<double> const *A, int LDA, std::complex<double> *B, int LDB, int &info) {
+    LAPACK_zpotrs(&UPLO, &N, &NRHS, A, &LDA, B, &LDB, &info);
+  }
+  void potrs(char UPLO, int N, int NRHS, float const *A, int LDA, float *B, int LDB, int &info) {
+    LAPACK_spotrs(&UPLO, &N, &NRHS, A, &LDA, B, &LDB, &info);
+  }
+  void potrs(char UPLO, int N, int NRHS, std::complex<float> const *A, int LDA, std::complex<float> *B, int LDB, int &info) {
+    LAPACK_cpotrs(&UPLO, &N, &NRHS, A, &LDA, B, &LDB, &info);
+  }
+
+  void spev(char JOBZ, char UPLO, int N, double *AP, double *W, double *Z, int LDZ, double *work, int &info) {
+    LAPACK_dspev(&JOBZ, &UPLO, &N, AP, W, Z, &LDZ, work, &info);
+  }
+  void spev(char JOBZ, char UPLO, int N, float *AP, float *W, float *Z, int LDZ, float *work, int &info) {
+    LAPACK_sspev(&JOBZ, &UPLO, &N, AP, W, Z, &LDZ, work, &info);
+  }
+
+  void hpev(char JOBZ, char UPLO, int N, std::complex<double> *AP, double *W, std::complex<double> *Z, int LDZ, std::complex<double> *work,
+            double *rwork, int &info) {
+    LAPACK_zhpev(&JOBZ, &UPLO, &N, AP, W, Z, &LDZ, work, rwork, &info);
+  }
+  void hpev(char JOBZ, char UPLO, int N, std::complex<float> *AP, float *W, std::complex<float> *Z, int LDZ, std::complex<float> *work,
+            float *rwork, int &info) {
+    LAPACK_chpev(&JOBZ, &UPLO, &N, AP, W, Z, &LDZ, work, rwork, &info);
+  }
+
+  void sptrf(char UPLO, int N, double *AP, int *ipiv, int &info) { LAPACK_dsptrf(&UPLO, &N, AP, ipiv, &info); }
+  void sptrf(char UPLO, int N, float *AP, int *ipiv, int &info) { LAPACK_ssptrf(&UPLO, &N, AP, ipiv, &info); }
+  void hptrf(char UPLO, int N, std::complex<double> *AP, int *ipiv, int &info) { LAPACK_zhptrf(&UPLO, &N, AP, ipiv, &info); }
+  void hptrf(char UPLO, int N, std::complex<float> *AP, int *ipiv, int &info) { LAPACK_chptrf(&UPLO, &N, AP, ipiv, &info); }
+
+  void sptrs(char UPLO, int N, int NRHS, double const *AP, int const *ipiv, double *B, int LDB, int &info) {
+    LAPACK_dsptrs(&UPLO, &N, &NRHS, AP, ipiv, B, &LDB, &info);
+  }
+  void sptrs(char UPLO, int N, int NRHS, float const *AP, int const *ipiv, float *B, int LDB, int &info) {
+    LAPACK_ssptrs(&UPLO, &N, &NRHS, AP, ipiv, B, &LDB, &info);
+  }
+  void hptrs(char UPLO, int N, int NRHS, std::complex<double> const *AP, int const *ipiv, std::complex<double> *B, int LDB, int &info) {
+    LAPACK_zhptrs(&UPLO, &N, &NRHS, AP, ipiv, B, &LDB, &info);
+  }
+  void hptrs(char UPLO, int N, int NRHS, std::complex<float> const *AP, int const *ipiv, std::complex<float> *B, int LDB, int &info) {
+    LAPACK_chptrs(&UPLO, &N, &NRHS, AP, ipiv, B, &LDB, &info);
+  }
 
   void stev(char J, int N, double *D, double *E, double *Z, int ldz, double *work, int &info) { LAPACK_dstev(&J, &N, D, E, Z, &ldz, work, &info); }
+  void stev(char J, int N, float *D, float *E, float *Z, int ldz, float *work, int &info) { LAPACK_sstev(&J, &N, D, E, Z, &ldz, work, &info); }
 
   void syev(char JOBZ, char UPLO, int N, double *A, int LDA, double *W, double *work, int &lwork, int &info) {
     LAPACK_dsyev(&JOBZ, &UPLO, &N, A, &LDA, W, work, &lwork, &info);
   }
+  void syev(char JOBZ, char UPLO, int N, float *A, int LDA, float *W, float *work, int &lwork, int &info) {
+    LAPACK_ssyev(&JOBZ, &UPLO, &N, A, &LDA, W, work, &lwork, &info);
+  }
 
   void heev(char JOBZ, char UPLO, int N, std::complex<double> *A, int LDA, double *W, std::complex<double> *work, int &lwork, double *work2,
             int &info) {
     LAPACK_zheev(&JOBZ, &UPLO, &N, A, &LDA, W, work, &lwork, work2, &info);
   }
+  void heev(char JOBZ, char UPLO, int N, std::complex<float> *A, int LDA, float *W, std::complex<float> *work, int &lwork, float *work2,
+            int &info) {
+    LAPACK_cheev(&JOBZ, &UPLO, &N, A, &LDA, W, work, &lwork, work2, &info);
+  }
+
+  void sygvd(int ITYPE, char JOBZ, char UPLO, int N, double *A, int LDA, double *B, int LDB, double *W, double *WORK, int LWORK, int *IWORK,
+             int LIWORK, int &INFO) {
+    LAPACK_dsygvd(&ITYPE, &JOBZ, &UPLO, &N, A, &LDA, B, &LDB, W, WORK, &LWORK, IWORK, &LIWORK, &INFO);
+  }
+  void sygvd(int ITYPE, char JOBZ, char UPLO, int N, float *A, int LDA, float *B, int LDB, float *W, float *WORK, int LWORK, int *IWORK, int LIWORK,
+             int &INFO) {
+    LAPACK_ssygvd(&ITYPE, &JOBZ, &UPLO, &N, A, &LDA, B, &LDB, W, WORK, &LWORK, IWORK, &LIWORK, &INFO);
+  }
 
-  void getrs(char TRANS, int N, int NRHS, double const *A, int LDA, int *ipiv, double *B, int LDB, int &info) {
+  void hegvd(int ITYPE, char JOBZ, char UPLO, int N, std::complex<double> *A, int LDA, std::complex<double> *B, int LDB, double *W,
+             std::complex<double> *WORK, int LWORK, double *RWORK, int LRWORK, int *IWORK, int LIWORK, int &INFO) {
+    LAPACK_zhegvd(&ITYPE, &JOBZ, &UPLO, &N, A, &LDA, B, &LDB, W, WORK, &LWORK, RWORK, &LRWORK, IWORK, &LIWORK, &INFO);
+  }
+  void hegvd(int ITYPE, char JOBZ, char UPLO, int N, std::complex<float> *A, int LDA, std::complex<float> *B, int LDB, float *W,
+             std::complex<float> *WORK, int LWORK, float *RWORK, int LRWORK, int *IWORK, int LIWORK, int &INFO) {
+    LAPACK_chegvd(&ITYPE, &JOBZ, &UPLO, &N, A, &LDA, B, &LDB, W, WORK, &LWORK, RWORK, &LRWORK, IWORK, &LIWORK, &INFO);
+  }
+
+  void getrs(char TRANS, int N, int NRHS, double const *A, int LDA, int const *ipiv, double *B, int LDB, int &info) {
     LAPACK_dgetrs(&TRANS, &N, &NRHS, A, &LDA, ipiv, B, &LDB, &info);
   }
-  void getrs(char TRANS, int N, int NRHS, std::complex<double> const *A, int LDA, int *ipiv, std::complex<double> *B, int LDB, int &info) {
+  void getrs(char TRANS, int N, int NRHS, std::complex<double> const *A, int LDA, int const *ipiv, std::complex<double> *B, int LDB, int &info) {
     LAPACK_zgetrs(&TRANS, &N, &NRHS, A, &LDA, ipiv, B, &LDB, &info);
   }
+  void getrs(char TRANS, int N, int NRHS, float const *A, int LDA, int const *ipiv, float *B, int LDB, int &info) {
+    LAPACK_sgetrs(&TRANS, &N, &NRHS, A, &LDA, ipiv, B, &LDB, &info);
+  }
+  void getrs(char TRANS, int N, int NRHS, std::complex<float> const *A, int LDA, int const *ipiv, std::complex<float> *B, int LDB, int &info) {
+    LAPACK_cgetrs(&TRANS, &N, &NRHS, A, &LDA, ipiv, B, &LDB, &info);
+  }
 
 } // namespace nda::lapack::f77
@@ -20,33 +20,166 @@
 
 namespace nda::lapack::f77 {
 
+  void gbsv(int N, int KL, int KU, int NRHS, double *AB, int LDAB, int *ipiv, double *B, int LDB, int &info);
+  void gbsv(int N, int KL, int KU, int NRHS, std::complex<double> *AB, int LDAB, int *ipiv, std::complex<double> *B, int LDB, int &info);
+  void gbsv(int N, int KL, int KU, int NRHS, float *AB, int LDAB, int *ipiv, float *B, int LDB, int &info);
+  void gbsv(int N, int KL, int KU, int NRHS, std::complex<float> *AB, int LDAB, int *ipiv, std::complex<float> *B, int LDB, int &info);
+
+  void gbtrf(int M, int N, int KL, int KU, double *AB, int LDAB, int *ipiv, int &info);
+  void gbtrf(int M, int N, int KL, int KU, std::complex<double> *AB, int LDAB, int *ipiv, int &info);
+  void gbtrf(int M, int N, int KL, int KU, float *AB, int LDAB, int *ipiv, int &info);
+  void gbtrf(int M, int N, int KL, int KU, std::complex<float> *AB, int LDAB, int *ipiv, int &info);
+
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, double const *AB, int LDAB, int const *ipiv, double *B, int LDB, int &info);
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, std::complex<double> const *AB, int LDAB, int const *ipiv, std::complex<double> *B, int LDB,
+             int &info);
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, float const *AB, int LDAB, int const *ipiv, float *B, int LDB, int &info);
+  void gbtrs(char TRANS, int N, int KL, int KU, int NRHS, std::complex<float> const *AB, int LDAB, int const *ipiv, std::complex<float> *B, int LDB,
+             int &info);
+
+  void gecon(char NORM, int N, double const *A, int LDA, double ANORM, double &RCOND, double *WORK, int *IWORK, int &INFO);
+  void gecon(char NORM, int N, std::complex<double> const *A, int LDA, double ANORM, double &RCOND, std::complex<double> *WORK, double *RWORK,
+             int &INFO);
+  void gecon(char NORM, int N, float const *A, int LDA, float ANORM, float &RCOND, float *WORK, int *IWORK, int &INFO);
+  void gecon(char NORM, int N, std::complex<float> const *A, int LDA, float ANORM, float &RCOND, std::complex<float> *WORK, float *RWORK,
+             int &INFO);
+
+  void geev(char JOBVL, char JOBVR, int N, double *A, int LDA, double *WR, double *WI, double *VL, int LDVL, double *VR, int LDVR, double *WORK,
+            int LWORK, int &INFO);
+  void geev(char JOBVL, char JOBVR, int N, std::complex<double> *A, int LDA, std::complex<double> *W, std::complex<double> *VL, int LDVL,
+            std::complex<double> *VR, int LDVR, std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO);
+  void geev(char JOBVL, char JOBVR, int N, float *A, int LDA, float *WR, float *WI, float *VL, int LDVL, float *VR, int LDVR, float *WORK, int LWORK,
+            int &INFO);
+  void geev(char JOBVL, char JOBVR, int N, std::complex<float> *A, int LDA, std::complex<float> *W, std::complex<float> *VL, int LDVL,
+            std::complex<float> *VR, int LDVR, std::complex<float> *WORK, int LWORK, float *RWORK, int &INFO);
+
   void gelss(int M, int N, int NRHS, double *A, int LDA, double *B, int LDB, double *S, double RCOND, int &RANK, double *WORK, int LWORK, int &INFO);
   void gelss(int M, int N, int NRHS, std::complex<double> *A, int LDA, std::complex<double> *B, int LDB, double *S, double RCOND, int &RANK,
              std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO);
+  void gelss(int M, int N, int NRHS, float *A, int LDA, float *B, int LDB, float *S, float RCOND, int &RANK, float *WORK, int LWORK, int &INFO);
+  void gelss(int M, int N, int NRHS, std::complex<float> *A, int LDA, std::complex<float> *B, int LDB, float *S, float RCOND, int &RANK,
+             std::complex<float> *WORK, int LWORK, float *RWORK, int &INFO);
+
+  void geqp3(int M, int N, double *A, int LDA, int *JPVT, double *TAU, double *WORK, int LWORK, int &INFO);
+  void geqp3(int M, int N, std::complex<double> *A, int LDA, int *JPVT, std::complex<double> *TAU, std::complex<double> *WORK,
+             int LWORK, double *RWORK, int &INFO);
+  void geqp3(int M, int N, float *A, int LDA, int *JPVT, float *TAU, float *WORK, int LWORK, int &INFO);
+  void geqp3(int M, int N, std::complex<float> *A, int LDA, int *JPVT, std::complex<float> *TAU, std::complex<float> *WORK,
+             int LWORK, float *RWORK, int &INFO);
+
+  void geqrf(int M, int N, double *A, int LDA, double *TAU, double *WORK, int LWORK, int &INFO);
+  void geqrf(int M, int N, std::complex<double> *A, int LDA, std::complex<double> *TAU, std::complex<double> *WORK, int LWORK, int &INFO);
+  void geqrf(int M, int N, float *A, int LDA, float *TAU, float *WORK, int LWORK, int &INFO);
+  void geqrf(int M, int N, std::complex<float> *A, int LDA, std::complex<float> *TAU, std::complex<float> *WORK, int LWORK, int &INFO);
+
+  void gesdd(char JOBZ, int M, int N, double *A, int LDA, double *S, double *U, int LDU, double *VT, int LDVT, double *WORK, int LWORK, int *IWORK,
+             int &INFO);
+  void gesdd(char JOBZ, int M, int N, std::complex<double> *A, int LDA, double *S, std::complex<double> *U, int LDU, std::complex<double> *VT,
+             int LDVT, std::complex<double> *WORK, int LWORK, double *RWORK, int *IWORK, int &INFO);
+  void gesdd(char JOBZ, int M, int N, float *A, int LDA, float *S, float *U, int LDU, float *VT, int LDVT, float *WORK, int LWORK, int *IWORK,
+             int &INFO);
+  void gesdd(char JOBZ, int M, int N, std::complex<float> *A, int LDA, float *S, std::complex<float> *U, int LDU, std::complex<float> *VT, int LDVT,
+             std::complex<float> *WORK, int LWORK, float *RWORK, int *IWORK, int &INFO);
 
   void gesvd(const char &JOBU, const char &JOBVT, int M, int N, double *A, int LDA, double *S, double *U, int LDU, double *VT, int LDVT, double *WORK,
              int LWORK, int &INFO);
   void gesvd(const char &JOBU, const char &JOBVT, int M, int N, std::complex<double> *A, int LDA, double *S, std::complex<double> *U, int LDU,
              std::complex<double> *VT, int LDVT, std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO);
+  void gesvd(const char &JOBU, const char &JOBVT, int M, int N, float *A, int LDA, float *S, float *U, int LDU, float *VT, int LDVT, float *WORK,
+             int LWORK, int &INFO);
+  void gesvd(const char &JOBU, const char &JOBVT, int M, int N, std::complex<float> *A, int LDA, float *S, std::complex<float> *U, int LDU,
+             std::complex<float> *VT, int LDVT, std::complex<float> *WORK, int LWORK, float *RWORK, int &INFO);
 
   void getrf(int M, int N, double *A, int LDA, int *ipiv, int &info);
   void getrf(int M, int N, std::complex<double> *A, int LDA, int *ipiv, int &info);
+  void getrf(int M, int N, float *A, int LDA, int *ipiv, int &info);
+  void getrf(int M, int N, std::complex<float> *A, int LDA, int *ipiv, int &info);
 
   void getri(int N, double *A, int LDA, int *ipiv, double *work, int lwork, int &info);
   void getri(int N, std::complex<double> *A, int LDA, int *ipiv, std::complex<double> *work, int lwork, int &info);
+  void getri(int N, float *A, int LDA, int *ipiv, float *work, int lwork, int &info);
+  void getri(int N, std::complex<float> *A, int LDA, int *ipiv, std::complex<float> *work, int lwork, int &info);
+
+  void gesv_mixed(int N, int NRHS, double *A, int LDA, int *ipiv, double const *B, int LDB, double *X, int LDX, double *work, float *swork, int &iter,
+                  int &info);
+  void gesv_mixed(int N, int NRHS, std::complex<double> *A, int LDA, int *ipiv, std::complex<double> const *B, int LDB, std::complex<double> *X,
+                  int LDX, std::complex<double> *work, std::complex<float> *swork, double *rwork, int &iter, int &info);
 
   void gtsv(int N, int NRHS, double *DL, double *D, double *DU, double *B, int LDB, int &info);
   void gtsv(int N, int NRHS, std::complex<double> *DL, std::complex<double> *D, std::complex<double> *DU, std::complex<double> *B, int LDB,
             int &info);
+  void gtsv(int N, int NRHS, float *DL, float *D, float *DU, float *B, int LDB, int &info);
+  void gtsv(int N, int NRHS, std::complex<float> *DL, std::complex<float> *D, std::complex<float> *DU, std::complex<float> *B, int LDB,
+            int &info);
+
+  double lange(char NORM, int M, int N, double const *A, int LDA, double *WORK);
+  double lange(char NORM, int M, int N, std::complex<double> const *A, int LDA, double *WORK);
+  float lange(char NORM, int M, int N, float const *A, int LDA, float *WORK);
+  float lange(char NORM, int M, int N, std::complex<float> const *A, int LDA, float *WORK);
+
+  void orgqr(int M, int N, int K, double *A, int LDA, double const *TAU, double *WORK, int LWORK, int &INFO);
+  void ungqr(int M, int N, int K, std::complex<double> *A, int LDA, std::complex<double> const *TAU, std::complex<double> *WORK, int LWORK,
+             int &INFO);
+  void orgqr(int M, int N, int K, float *A, int LDA, float const *TAU, float *WORK, int LWORK, int &INFO);
+  void ungqr(int M, int N, int K, std::complex<float> *A, int LDA, std::complex<float> const *TAU, std::complex<float> *WORK, int LWORK, int &INFO);
+
+  void potrf(char UPLO, int N, double *A, int LDA, int &info);
+  void potrf(char UPLO, int N, std::complex<double> *A, int LDA, int &info);
+  void potrf(char UPLO, int N, float *A, int LDA, int &info);
+  void potrf(char UPLO, int N, std::complex<float> *A, int LDA, int &info);
+
+  void potri(char UPLO, int N, double *A, int LDA, int &info);
+  void potri(char UPLO, int N, std::complex<double> *A, int LDA, int &info);
+  void potri(char UPLO, int N, float *A, int LDA, int &info);
+  void potri(char UPLO, int N, std::complex<float> *A, int LDA, int &info);
+
+  void potrs(char UPLO, int N, int NRHS, double const *A, int LDA, double *B, int LDB, int &info);
+  void potrs(char UPLO, int N, int NRHS, std::complex<double> const *A, int LDA, std::complex<double> *B, int LDB, int &info);
+  void potrs(char UPLO, int N, int NRHS, float const *A, int LDA, float *B, int LDB, int &info);
+  void potrs(char UPLO, int N, int NRHS, std::complex<float> const *A, int LDA, std::complex<float> *B, int LDB, int &info);
+
+  void spev(char JOBZ, char UPLO, int N, double *AP, double *W, double *Z, int LDZ, double *work, int &info);
+  void spev(char JOBZ, char UPLO, int N, float *AP, float *W, float *Z, int LDZ, float *work, int &info);
+
+  void hpev(char JOBZ, char UPLO, int N, std::complex<double> *AP, double *W, std::complex<double> *Z, int LDZ, std::complex<double> *work,
+            double *rwork, int &info);
+  void hpev(char JOBZ, char UPLO, int N, std::complex<float> *AP, float *W, std::complex<float> *Z, int LDZ, std::complex<float> *work,
+            float *rwork, int &info);
+
+  void sptrf(char UPLO, int N, double *AP, int *ipiv, int &info);
+  void sptrf(char UPLO, int N, float *AP, int *ipiv, int &info);
+  void hptrf(char UPLO, int N, std::complex<double> *AP, int *ipiv, int &info);
+  void hptrf(char UPLO, int N, std::complex<float> *AP, int *ipiv, int &info);
+
+  void sptrs(char UPLO, int N, int NRHS, double const *AP, int const *ipiv, double *B, int LDB, int &info);
+  void sptrs(char UPLO, int N, int NRHS, float const *AP, int const *ipiv, float *B, int LDB, int &info);
+  void hptrs(char UPLO, int N, int NRHS, std::complex<double> const *AP, int const *ipiv, std::complex<double> *B, int LDB, int &info);
+  void hptrs(char UPLO, int N, int NRHS, std::complex<float> const *AP, int const *ipiv, std::complex<float> *B, int LDB, int &info);
 
   void stev(char J, int N, double *D, double *E, double *Z, int ldz, double *work, int &info);
+  void stev(char J, int N, float *D, float *E, float *Z, int ldz, float *work, int &info);
 
   void syev(char JOBZ, char UPLO, int N, double *A, int LDA, double *W, double *work, int &lwork, int &info);
+  void syev(char JOBZ, char UPLO, int N, float *A, int LDA, float *W, float *work, int &lwork, int &info);
 
   void heev(char JOBZ, char UPLO, int N, std::complex<double> *A, int LDA, double *W, std::complex<double> *work, int &lwork, double *work2,
             int &info);
+  void heev(char JOBZ, char UPLO, int N, std::complex<float> *A, int LDA, float *W, std::complex<float> *work, int &lwork, float *work2,
+            int &info);
+
+  void sygvd(int ITYPE, char JOBZ, char UPLO, int N, double *A, int LDA, double *B, int LDB, double *W, double *WORK, int LWORK, int *IWORK,
+             int LIWORK, int &INFO);
+  void sygvd(int ITYPE, char JOBZ, char UPLO, int N, float *A, int LDA, float *B, int LDB, float *W, float *WORK, int LWORK, int *IWORK, int LIWORK,
+             int &INFO);
+
+  void hegvd(int ITYPE, char JOBZ, char UPLO, int N, std::complex<double> *A, int LDA, std::complex<double> *B, int LDB, double *W,
+             std::complex<double> *WORK, int LWORK, double *RWORK, int LRWORK, int *IWORK, int LIWORK, int &INFO);
+  void hegvd(int ITYPE, char JOBZ, char UPLO, int N, std::complex<float> *A, int LDA, std::complex<float> *B, int LDB, float *W,
+             std::complex<float> *WORK, int LWORK, float *RWORK, int LRWORK, int *IWORK, int LIWORK, int &INFO);
 
-  void getrs(char TRANS, int N, int NRHS, double const *A, int LDA, int *ipiv, double *B, int LDB, int &info);
-  void getrs(char TRANS, int N, int NRHS, std::complex<double> const *A, int LDA, int *ipiv, std::complex<double> *B, int LDB, int &info);
+  void getrs(char TRANS, int N, int NRHS, double const *A, int LDA, int const *ipiv, double *B, int LDB, int &info);
+  void getrs(char TRANS, int N, int NRHS, std::complex<double> const *A, int LDA, int const *ipiv, std::complex<double> *B, int LDB, int &info);
+  void getrs(char TRANS, int N, int NRHS, float const *A, int LDA, int const *ipiv, float *B, int LDB, int &info);
+  void getrs(char TRANS, int N, int NRHS, std::complex<float> const *A, int LDA, int const *ipiv, std::complex<float> *B, int LDB, int &info);
 
 } // namespace nda::lapack::f77
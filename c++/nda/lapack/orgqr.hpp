@@ -0,0 +1,69 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Generate the M x N matrix Q with orthonormal columns (M >= N), the first N columns of the product
+   * of the K reflectors returned by geqrf (lapack orgqr for real, ungqr for complex element types).
+   *
+   * @param a On entry, the reflectors as returned by geqrf in its first K columns. On return, Q.
+   *          In Fortran order with unit smallest stride.
+   * @param tau The scalar factors of the reflectors, as returned by geqrf. K = tau.size() <= N.
+   * @return The info returned by orgqr/ungqr
+   */
+  template <MatrixView A, VectorView TAU>
+  int orgqr(A &&a, TAU const &tau) {
+    using T = get_value_t<A>;
+    static_assert(is_blas_lapack_v<T>, "orgqr : the matrix must have elements of type double or complex");
+    static_assert(have_same_value_type_v<A, TAU>, "orgqr : tau must have the element type of the matrix");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran(), "orgqr : C order not implemented");
+    EXPECTS(a.indexmap().min_stride() == 1);
+
+    int m = a.extent(0), n = a.extent(1), k = tau.size();
+    EXPECTS(m >= n and n >= k);
+    if (n == 0) return 0;
+    EXPECTS(k == 0 or tau.indexmap().min_stride() == 1);
+
+    auto call = [&](T *work, int lwork, int &info) {
+      if constexpr (is_complex_v<T>)
+        f77::ungqr(m, n, k, a.data(), get_ld(a), tau.data(), work, lwork, info);
+      else
+        f77::orgqr(m, n, k, a.data(), get_ld(a), tau.data(), work, lwork, info);
+    };
+
+    // first call to get the optimal lwork
+    int info = 0;
+    T work1[1];
+    call(work1, -1, info);
+    int lwork = std::round(std::real(work1[0])) + 1;
+    array<T, 1> work(lwork);
+    call(work.data(), lwork, info);
+
+    if (info) NDA_RUNTIME_ERROR << "Error in orgqr : info = " << info;
+    return info;
+  }
+
+  /// The lapack name of orgqr for complex element types
+  template <MatrixView A, VectorView TAU>
+  int ungqr(A &&a, TAU const &tau) {
+    static_assert(is_complex_v<get_value_t<A>>, "ungqr : the matrix must have complex elements. Use orgqr for real ones.");
+    return orgqr(std::forward<A>(a), tau);
+  }
+
+} // namespace nda::lapack
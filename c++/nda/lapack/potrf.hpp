@@ -0,0 +1,47 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Cholesky decomposition of a symmetric (hermitian) positive definite matrix
+   *
+   *    A = U^H * U  (uplo = 'U')  or  A = L * L^H  (uplo = 'L')
+   *
+   * The matrix m is modified during the operation: the triangle uplo is overwritten by the factor,
+   * the other triangle is not referenced.
+   * The matrix is interpreted as FORTRAN ordered.
+   * NB : for a C ordered hermitian matrix, lapack sees the complex conjugate.
+   *
+   * @tparam M matrix, matrix_view, array, array_view of rank 2. M can be a temporary view
+   * @param m  matrix to be decomposed. It is destroyed by the operation
+   * @param uplo 'U' or 'L', the triangle of m (seen in Fortran order) to use
+   * @return info, cf lapack doc. A positive value indicates that the matrix is not positive definite
+   */
+  template <ArrayOfRank<2> M>
+  [[nodiscard]] int potrf(M &&m, char uplo = 'U') {
+    static_assert(is_blas_lapack_v<get_value_t<M>>, "Matrix must have elements of type double or complex");
+    EXPECTS(m.extent(0) == m.extent(1));
+    EXPECTS(m.indexmap().min_stride() == 1);
+
+    int info = 0;
+    f77::potrf(uplo, get_n_rows(m), m.data(), get_ld(m), info);
+    return info;
+  }
+
+} // namespace nda::lapack
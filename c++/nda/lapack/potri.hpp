@@ -0,0 +1,42 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Computes the inverse of a symmetric (hermitian) positive definite matrix
+   * using the Cholesky factorization computed by potrf.
+   *
+   * Only the triangle uplo of m (seen in Fortran order) is overwritten by the inverse.
+   *
+   * @tparam M matrix, matrix_view, array, array_view of rank 2. M can be a temporary view
+   * @param m  The Cholesky factor computed by potrf. It is replaced by (a triangle of) the inverse.
+   * @param uplo The triangle used in potrf
+   */
+  template <ArrayOfRank<2> M>
+  [[nodiscard]] int potri(M &&m, char uplo = 'U') {
+    static_assert(is_blas_lapack_v<get_value_t<M>>, "Matrix must have elements of type double or complex");
+    EXPECTS(m.extent(0) == m.extent(1));
+    EXPECTS(m.indexmap().min_stride() == 1);
+
+    int info = 0;
+    f77::potri(uplo, get_n_rows(m), m.data(), get_ld(m), info);
+    return info;
+  }
+
+} // namespace nda::lapack
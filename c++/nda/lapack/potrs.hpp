@@ -0,0 +1,44 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * potrs solves a system of linear equations
+   *      A * X = B
+   * with a symmetric (hermitian) positive definite matrix A using the Cholesky factorization computed by potrf.
+   *
+   * @tparam A Array of rank 2 and shape (N,N), with unit smallest stride
+   * @tparam B Array of rank 2 and shape (N,NRHS) in Fortran order, with unit smallest stride
+   * @param uplo The triangle used in potrf
+   */
+  template <ArrayOfRank<2> A, ArrayOfRank<2> B>
+  [[nodiscard]] int potrs(A const &a, B &&b, char uplo = 'U') {
+    static_assert(std::is_same_v<get_value_t<A>, get_value_t<B>>, "Matrices must have the same element type");
+    static_assert(is_blas_lapack_v<get_value_t<A>>, "Matrices must have elements of type double or complex");
+    static_assert(std::decay_t<B>::is_stride_order_Fortran(), "potrs : B must be in Fortran order");
+    EXPECTS(a.indexmap().min_stride() == 1);
+    EXPECTS(b.indexmap().min_stride() == 1);
+    EXPECTS(a.extent(0) == b.extent(0));
+
+    int info = 0;
+    f77::potrs(uplo, get_n_rows(a), b.extent(1), a.data(), get_ld(a), b.data(), get_ld(b), info);
+    return info;
+  }
+
+} // namespace nda::lapack
@@ -0,0 +1,62 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Eigenvalues and (optionally) eigenvectors of a symmetric (real) or hermitian (complex) matrix in packed storage.
+   * Calls spev for real and hpev for complex element types.
+   *
+   * @param ap The triangle of A in packed storage (cf. packed_idx_map), contiguous. It is destroyed by the operation.
+   * @param w The eigenvalues, in ascending order. Resized to the dimension of A if necessary.
+   * @param z If not empty, the eigenvectors as columns : a matrix of shape (N, N) in Fortran order, with unit smallest stride.
+   *          If empty, only the eigenvalues are computed.
+   * @param uplo 'U' (resp. 'L') if ap holds the upper (resp. lower) triangle of A
+   */
+  template <VectorView AP, VectorView W, MatrixView Z>
+  [[nodiscard]] int spev(AP &&ap, W &&w, Z &&z, char uplo = 'U') {
+    using T = get_value_t<AP>;
+    static_assert(is_blas_lapack_v<T>, "spev : the matrix must have elements of type double or complex");
+    static_assert(std::is_same_v<get_value_t<W>, real_value_t<T>>, "spev : the eigenvalues must be real, with the precision of the matrix");
+    static_assert(std::is_same_v<get_value_t<Z>, T>, "spev : the eigenvectors must have the element type of the matrix");
+    static_assert(std::decay_t<Z>::is_stride_order_Fortran(), "spev : z must be in Fortran order");
+    EXPECTS(ap.indexmap().min_stride() == 1);
+    EXPECTS(w.indexmap().min_stride() == 1);
+
+    int n = packed_idx_map::dim_from_size(ap.size());
+    if constexpr (is_regular_v<std::decay_t<W>>) {
+      if (w.size() != n) w.resize(n);
+    }
+    EXPECTS(w.size() == n);
+    char jobz = (z.empty() ? 'N' : 'V');
+    if (jobz == 'V') EXPECTS(z.extent(0) == n and z.extent(1) == n and z.indexmap().min_stride() == 1);
+    int ldz = (jobz == 'V' ? get_ld(z) : 1);
+
+    int info = 0;
+    if constexpr (is_complex_v<T>) {
+      array<T, 1> work(std::max(1, 2 * n - 1));
+      array<real_value_t<T>, 1> rwork(std::max(1, 3 * n - 2));
+      f77::hpev(jobz, uplo, n, ap.data(), w.data(), z.data(), ldz, work.data(), rwork.data(), info);
+    } else {
+      array<T, 1> work(std::max(1, 3 * n));
+      f77::spev(jobz, uplo, n, ap.data(), w.data(), z.data(), ldz, work.data(), info);
+    }
+    return info;
+  }
+
+} // namespace nda::lapack
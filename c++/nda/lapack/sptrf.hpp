@@ -0,0 +1,80 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Bunch-Kaufman factorization A = U * D * U^H of a symmetric (real) or hermitian (complex) matrix in packed storage.
+   * Calls sptrf for real and hptrf for complex element types.
+   *
+   * @param ap The triangle of A in packed storage (cf. packed_idx_map), contiguous. It is overwritten by the factorization.
+   * @param ipiv The pivots, resized to the dimension of A if necessary
+   * @param uplo 'U' (resp. 'L') if ap holds the upper (resp. lower) triangle of A
+   */
+  template <VectorView AP, ArrayOfRank<1> IPIV>
+  [[nodiscard]] int sptrf(AP &&ap, IPIV &ipiv, char uplo = 'U') {
+    using T = get_value_t<AP>;
+    static_assert(is_blas_lapack_v<T>, "sptrf : the matrix must have elements of type double or complex");
+    static_assert(std::is_same_v<get_value_t<IPIV>, int>, "sptrf : pivoting array must have elements of type int");
+    EXPECTS(ap.indexmap().min_stride() == 1);
+
+    int n = packed_idx_map::dim_from_size(ap.size());
+    if (ipiv.size() < n) ipiv.resize(n);
+
+    int info = 0;
+    if constexpr (is_complex_v<T>)
+      f77::hptrf(uplo, n, ap.data(), ipiv.data(), info);
+    else
+      f77::sptrf(uplo, n, ap.data(), ipiv.data(), info);
+    return info;
+  }
+
+  /**
+   * Solve A * X = B with the factorization of a packed symmetric (real) or hermitian (complex) matrix computed by sptrf.
+   * Calls sptrs for real and hptrs for complex element types.
+   *
+   * @param ap The factorization computed by sptrf
+   * @param ipiv The pivots computed by sptrf
+   * @param b Vector, or matrix in Fortran order with unit smallest stride. It is overwritten by the solution X.
+   * @param uplo The triangle used in sptrf
+   */
+  template <VectorView AP, ArrayOfRank<1> IPIV, MemoryArray B>
+  [[nodiscard]] int sptrs(AP const &ap, IPIV const &ipiv, B &&b, char uplo = 'U') {
+    using T = get_value_t<AP>;
+    static_assert(std::is_same_v<get_value_t<B>, T>, "sptrs : the matrix and the right hand side must have the same element type");
+    static_assert(get_rank<B> == 1 or std::decay_t<B>::is_stride_order_Fortran(), "sptrs : B must be a vector or a matrix in Fortran order");
+    EXPECTS(ap.indexmap().min_stride() == 1);
+    EXPECTS(b.indexmap().min_stride() == 1);
+
+    int n = packed_idx_map::dim_from_size(ap.size());
+    EXPECTS(b.extent(0) == n);
+    int nrhs = 1, ldb = std::max(n, 1);
+    if constexpr (get_rank<B> == 2) {
+      nrhs = b.extent(1);
+      ldb  = get_ld(b);
+    }
+
+    int info = 0;
+    if constexpr (is_complex_v<T>)
+      f77::hptrs(uplo, n, nrhs, ap.data(), ipiv.data(), b.data(), ldb, info);
+    else
+      f77::sptrs(uplo, n, nrhs, ap.data(), ipiv.data(), b.data(), ldb, info);
+    return info;
+  }
+
+} // namespace nda::lapack
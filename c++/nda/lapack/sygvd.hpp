@@ -0,0 +1,102 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+namespace nda::lapack {
+
+  /**
+   * Generalized symmetric (hermitian) definite eigenproblem, with the divide and conquer lapack sygvd (hegvd for complex types) :
+   *   A x = lambda B x (itype = 1), A B x = lambda x (itype = 2) or B A x = lambda x (itype = 3),
+   * A being symmetric (hermitian) and B positive definite.
+   *
+   * The problem is reduced to a standard one with the Cholesky factorization of B, without forming B^{-1} A.
+   *
+   * @param a The N x N matrix A, in Fortran order with unit smallest stride, of which only the triangle uplo is referenced.
+   *          For jobz = 'V', overwritten by the eigenvectors as columns, normalized such that X^H B X = 1 (itype = 1, 2)
+   *          or X^H B^{-1} X = 1 (itype = 3). Otherwise destroyed.
+   * @param b The N x N positive definite matrix B, in Fortran order with unit smallest stride, of which only the triangle uplo is referenced.
+   *          Overwritten by its Cholesky factor.
+   * @param w The eigenvalues, in ascending order. Resized to N if necessary.
+   * @param jobz 'V' (eigenvalues and eigenvectors) or 'N' (eigenvalues only)
+   * @param uplo 'U' or 'L' : the triangle of A and B referenced
+   * @param itype 1, 2 or 3 : the form of the problem
+   * @param ws The workspace, reused from one call to the next
+   * @return The info returned by sygvd. 0 < info <= N : the algorithm failed to converge.
+   *         info > N : the leading minor of order info - N of B is not positive definite.
+   */
+  template <MatrixView A, MatrixView B, VectorView W>
+  int sygvd(A &&a, B &&b, W &&w, char jobz, char uplo, int itype, eigen_workspace<get_value_t<A>> &ws) {
+    using T = get_value_t<A>;
+    using R = real_value_t<T>;
+    static_assert(is_blas_lapack_v<T>, "sygvd : the matrices must have elements of type double or complex");
+    static_assert(have_same_value_type_v<A, B>, "sygvd : the matrices must have the same element type");
+    static_assert(std::is_same_v<get_value_t<W>, R>, "sygvd : the eigenvalues must be real, with the precision of the matrices");
+    static_assert(std::decay_t<A>::is_stride_order_Fortran() and std::decay_t<B>::is_stride_order_Fortran(), "sygvd : C order not implemented");
+    EXPECTS(jobz == 'V' or jobz == 'N');
+    EXPECTS(uplo == 'U' or uplo == 'L');
+    EXPECTS(itype >= 1 and itype <= 3);
+    EXPECTS(a.extent(0) == a.extent(1) and b.shape() == a.shape());
+    EXPECTS(a.indexmap().min_stride() == 1 and b.indexmap().min_stride() == 1);
+
+    int n = a.extent(0);
+    if constexpr (is_regular_v<std::decay_t<W>>) {
+      if (w.size() != n) w.resize(n);
+    }
+    EXPECTS(w.size() == n);
+    if (n == 0) return 0;
+    EXPECTS(w.indexmap().min_stride() == 1);
+
+    auto call = [&](T *work, int lwork, R *rwork, int lrwork, int *iwork, int liwork, int &info) {
+      if constexpr (is_complex_v<T>)
+        f77::hegvd(itype, jobz, uplo, n, a.data(), get_ld(a), b.data(), get_ld(b), w.data(), work, lwork, rwork, lrwork, iwork, liwork, info);
+      else
+        f77::sygvd(itype, jobz, uplo, n, a.data(), get_ld(a), b.data(), get_ld(b), w.data(), work, lwork, iwork, liwork, info);
+    };
+
+    // first call to get the optimal sizes of the workspaces
+    int info = 0;
+    T work1[1];
+    R rwork1[1];
+    int iwork1[1];
+    call(work1, -1, rwork1, -1, iwork1, -1, info);
+    int lwork  = std::round(std::real(work1[0])) + 1;
+    int lrwork = (is_complex_v<T> ? int(std::round(rwork1[0])) + 1 : 1);
+    int liwork = iwork1[0];
+    details::reserve_workspace(ws.work, lwork);
+    details::reserve_workspace(ws.rwork, lrwork);
+    details::reserve_workspace(ws.iwork, liwork);
+    call(ws.work.data(), lwork, ws.rwork.data(), lrwork, ws.iwork.data(), liwork, info);
+
+    if (info < 0) NDA_RUNTIME_ERROR << "Error in sygvd : info = " << info;
+    return info;
+  }
+
+  /// sygvd with a workspace allocated for this call only, cf. above
+  template <MatrixView A, MatrixView B, VectorView W>
+  int sygvd(A &&a, B &&b, W &&w, char jobz = 'V', char uplo = 'U', int itype = 1) {
+    auto ws = eigen_workspace<get_value_t<A>>{};
+    return sygvd(std::forward<A>(a), std::forward<B>(b), std::forward<W>(w), jobz, uplo, itype, ws);
+  }
+
+  /// The lapack name of sygvd for complex element types
+  template <MatrixView A, MatrixView B, VectorView W>
+  int hegvd(A &&a, B &&b, W &&w, char jobz = 'V', char uplo = 'U', int itype = 1) {
+    static_assert(is_complex_v<get_value_t<A>>, "hegvd : the matrices must have complex elements. Use sygvd for real ones.");
+    return sygvd(std::forward<A>(a), std::forward<B>(b), std::forward<W>(w), jobz, uplo, itype);
+  }
+
+} // namespace nda::lapack
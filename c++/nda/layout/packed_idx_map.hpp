@@ -0,0 +1,63 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+#include <array>
+#include <cmath>
+#include "../macros.hpp"
+
+namespace nda {
+
+  /**
+   * Mapping of a triangle of a n x n matrix onto the (lapack) packed storage, column by column.
+   *
+   * The upper triangle (uplo = 'U') is stored as (i, j) -> i + j * (j + 1) / 2 for i <= j,
+   * the lower one (uplo = 'L') as (i, j) -> i + j * (2 * n - j - 1) / 2 for i >= j.
+   * The storage has n * (n + 1) / 2 elements, half of the dense one.
+   *
+   * Unlike idx_map, the mapping is not strided : it is used by packed containers and the blas/lapack packed routines,
+   * not by basic_array.
+   */
+  struct packed_idx_map {
+    long n    = 0;
+    char uplo = 'U';
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const noexcept { return n; }
+
+    /// Shape of the (full) matrix
+    [[nodiscard]] std::array<long, 2> lengths() const noexcept { return {n, n}; }
+
+    /// Number of stored elements
+    [[nodiscard]] long size() const noexcept { return n * (n + 1) / 2; }
+
+    /// Is (i, j) in the stored triangle ?
+    [[nodiscard]] bool is_stored(long i, long j) const noexcept { return (uplo == 'U' ? i <= j : i >= j); }
+
+    /// Position of the element (i, j) in the packed storage. (i, j) must be in the stored triangle.
+    [[nodiscard]] long operator()(long i, long j) const noexcept {
+      EXPECTS(is_stored(i, j));
+      return (uplo == 'U' ? i + j * (j + 1) / 2 : i + j * (2 * n - j - 1) / 2);
+    }
+
+    /// The dimension n of the matrix stored in a packed storage of the given size, i.e. the solution of n * (n + 1) / 2 = size
+    static long dim_from_size(long size) {
+      long n = std::lround((std::sqrt(8.0 * size + 1) - 1) / 2);
+      EXPECTS_WITH_MESSAGE(n * (n + 1) / 2 == size, "packed_idx_map : " << size << " is not the size of a packed triangular storage");
+      return n;
+    }
+  };
+
+} // namespace nda
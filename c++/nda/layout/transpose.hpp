@@ -0,0 +1,104 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+namespace nda::details {
+
+  // Side of the square tiles of the transposition : a tile of the source and one of the destination stay in L1
+  constexpr long transpose_tile = 32;
+
+  // Minimal number of elements for the transposition to be parallelized (if compiled with OpenMP)
+  constexpr long transpose_parallel_threshold = 1l << 18;
+
+  // The fastest dimension (smallest stride), ignoring the dimensions of length 1. -1 if there is none.
+  template <size_t R>
+  int fastest_dim(std::array<long, R> const &shape, std::array<long, R> const &strides) {
+    int r = -1;
+    for (int k = 0; k < int(R); ++k)
+      if (shape[k] > 1 and (r < 0 or std::abs(strides[k]) < std::abs(strides[r]))) r = k;
+    return r;
+  }
+
+  /**
+   * Call op(dst[...], src[...]) on all the elements of two arrays of the same shape, with arbitrary strides,
+   * i.e. a tensor transposition when the stride orders differ.
+   *
+   * The plane spanned by the fastest dimensions of dst and src is cut into square tiles.
+   * In a tile, the writes are contiguous, and the strided reads are on a few cache lines which stay in L1.
+   * The other dimensions are looped over outside of the tiles.
+   */
+  template <size_t R, typename T, typename U, typename Op>
+  void transpose_apply(std::array<long, R> const &shape, T *dst, std::array<long, R> const &dst_str, U const *src,
+                       std::array<long, R> const &src_str, Op const &op) {
+    for (auto l : shape)
+      if (l == 0) return;
+
+    int a = fastest_dim(shape, dst_str), b = fastest_dim(shape, src_str);
+    if (a < 0) { // a single element
+      op(dst[0], src[0]);
+      return;
+    }
+    if (b == a) b = -1; // same fastest dimension : no tiles needed
+
+    std::array<int, R> outer{};
+    int n_outer_dims = 0;
+    long n_outer     = 1;
+    for (int k = 0; k < int(R); ++k)
+      if (k != a and k != b) {
+        outer[n_outer_dims++] = k;
+        n_outer *= shape[k];
+      }
+
+    long La = shape[a], da = dst_str[a], sa = src_str[a];
+    long Lb = (b < 0 ? 1 : shape[b]), db = (b < 0 ? 0 : dst_str[b]), sb = (b < 0 ? 0 : src_str[b]);
+    long tile_a     = (b < 0 ? La : transpose_tile);
+    long n_blocks_a = (La + tile_a - 1) / tile_a;
+    long n_work     = n_outer * n_blocks_a;
+
+#ifdef _OPENMP
+#pragma omp parallel for if (n_outer * La * Lb >= transpose_parallel_threshold)
+#endif
+    for (long w = 0; w < n_work; ++w) {
+      long o = w / n_blocks_a, ia0 = (w % n_blocks_a) * tile_a, ia1 = std::min(ia0 + tile_a, La);
+
+      // offsets of the outer indices
+      long off_d = 0, off_s = 0;
+      for (int u = n_outer_dims - 1; u >= 0; --u) {
+        long k = outer[u], i = o % shape[k];
+        o /= shape[k];
+        off_d += i * dst_str[k];
+        off_s += i * src_str[k];
+      }
+
+      for (long ib0 = 0; ib0 < Lb; ib0 += transpose_tile) {
+        long ib1 = std::min(ib0 + transpose_tile, Lb);
+        for (long ib = ib0; ib < ib1; ++ib) {
+          T *__restrict d       = dst + off_d + ib * db;
+          U const *__restrict s = src + off_s + ib * sb;
+          if (da == 1) // the common case, with contiguous writes
+            for (long ia = ia0; ia < ia1; ++ia) op(d[ia], s[ia * sa]);
+          else
+            for (long ia = ia0; ia < ia1; ++ia) op(d[ia * da], s[ia * sa]);
+        }
+      }
+    }
+  }
+
+} // namespace nda::details
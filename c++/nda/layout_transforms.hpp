@@ -124,6 +124,30 @@ namespace nda {
     return permuted_indices_view<encode(permutations::transposition<std::decay_t<A>::rank>(I, J))>(std::forward<A>(a));
   }
 
+  // --------------- transpose_assign ------------------------
+
+  /**
+   * Compute dst <- alpha * src + beta * dst, for two arrays of the same shape and arbitrary strides,
+   * e.g. src = permuted_indices_view<...>(a), using the tiled transposition kernel.
+   *
+   * NB : The plain assignment dst = src uses the same kernel when the fastest indices of dst and src differ.
+   *
+   * @param beta If beta == 0, dst is not read, it can be uninitialized.
+   */
+  template <MemoryArray S, typename D>
+  void transpose_assign(get_value_t<std::decay_t<D>> const &alpha, S const &src, get_value_t<std::decay_t<D>> const &beta, D &&dst) requires(
+     MemoryArray<std::decay_t<D>>) {
+    static_assert(get_rank<S> == get_rank<std::decay_t<D>>, "transpose_assign : rank mismatch");
+    EXPECTS(src.shape() == dst.shape());
+    using T = get_value_t<std::decay_t<D>>;
+    if (beta == T{0})
+      details::transpose_apply(dst.shape(), dst.data(), dst.indexmap().strides(), src.data(), src.indexmap().strides(),
+                               [&alpha](auto &x, auto const &y) { x = alpha * y; });
+    else
+      details::transpose_apply(dst.shape(), dst.data(), dst.indexmap().strides(), src.data(), src.indexmap().strides(),
+                               [&alpha, &beta](auto &x, auto const &y) { x = alpha * y + beta * x; });
+  }
+
   // --------------- Grouping indices------------------------
 
   // FIXME : write the doc
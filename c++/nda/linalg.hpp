@@ -21,7 +21,22 @@
 #include "lapack.hpp"
 #include "blas.hpp"
 
+#include "linalg/band_matrix.hpp"
+#include "linalg/block_matrix.hpp"
 #include "linalg/cross_product.hpp"
+#include "linalg/cholesky_factorization.hpp"
+#include "linalg/contract.hpp"
 #include "linalg/det_and_inverse.hpp"
 #include "linalg/eigenelements.hpp"
+#include "linalg/iterative_eigensolvers.hpp"
+#include "linalg/krylov.hpp"
+#include "linalg/lu_factorization.hpp"
 #include "linalg/matmul.hpp"
+#include "linalg/matmul_chain.hpp"
+#include "linalg/matrix_functions.hpp"
+#include "linalg/packed_matrix.hpp"
+#include "linalg/qr.hpp"
+#include "linalg/randomized_svd.hpp"
+#include "linalg/solve.hpp"
+#include "linalg/svd.hpp"
+#include "linalg/triangular.hpp"
@@ -0,0 +1,274 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include "../blas/gbmv.hpp"
+#include "../lapack.hpp"
+#include "./det_and_inverse.hpp"
+#include "./rhs_dispatch.hpp"
+
+namespace nda {
+
+  /**
+   * Square band matrix, with kl sub-diagonals and ku super-diagonals, in the lapack band storage.
+   *
+   * The storage is a Fortran ordered matrix of shape (2 * kl + ku + 1, n), A(i, j) being stored at (kl + ku + i - j, j).
+   * Its first kl rows are not part of the matrix : they are the workspace needed by the LU factorization (gbtrf),
+   * so that a factorization is a plain copy of the storage.
+   *
+   * Products with vectors and matrices use blas gbmv, and the linear systems are solved in O(n * kl * (kl + ku))
+   * with band_lu_factorization (lapack gbtrf/gbtrs), instead of O(n^3) for a dense matrix.
+   *
+   * @tparam T Element type
+   */
+  template <typename T>
+  class band_matrix {
+    long _n  = 0;
+    long _kl = 0;
+    long _ku = 0;
+    matrix<T, F_layout> _ab;
+
+    public:
+    using value_type = T;
+
+    /// An empty 0 x 0 matrix
+    band_matrix() = default;
+
+    /// The n x n zero band matrix with kl sub-diagonals and ku super-diagonals
+    band_matrix(long n, long kl, long ku) : _n(n), _kl(kl), _ku(ku), _ab(2 * kl + ku + 1, n) {
+      EXPECTS(kl >= 0 and ku >= 0);
+      _ab = 0;
+    }
+
+    /**
+     * The band of a dense square matrix. The elements outside of the band are ignored.
+     * @param m A matrix, a view or a lazy expression
+     * @param kl Number of sub-diagonals
+     * @param ku Number of super-diagonals
+     */
+    template <ArrayOfRank<2> M>
+    band_matrix(M const &m, long kl, long ku) : band_matrix(m.shape()[0], kl, ku) {
+      EXPECTS(is_matrix_square(m, true));
+      for (long j = 0; j < _n; ++j)
+        for (long i = first_row(j); i <= last_row(j); ++i) _ab(_kl + _ku + i - j, j) = m(i, j);
+    }
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const { return _n; }
+
+    /// Shape of the matrix
+    [[nodiscard]] std::array<long, 2> shape() const { return {_n, _n}; }
+
+    /// Number of sub-diagonals
+    [[nodiscard]] long kl() const { return _kl; }
+
+    /// Number of super-diagonals
+    [[nodiscard]] long ku() const { return _ku; }
+
+    /// First row of the band in column j
+    [[nodiscard]] long first_row(long j) const { return std::max(0l, j - _ku); }
+
+    /// Last row of the band in column j
+    [[nodiscard]] long last_row(long j) const { return std::min(_n - 1, j + _kl); }
+
+    /// Is (i, j) in the band ?
+    [[nodiscard]] bool in_band(long i, long j) const { return (i - j <= _kl) and (j - i <= _ku); }
+
+    /// The full storage, including the kl rows of workspace for gbtrf
+    [[nodiscard]] matrix<T, F_layout> const &storage() const { return _ab; }
+
+    /// The band storage as expected by gbmv, i.e. without the workspace : A(i, j) is at (ku + i - j, j)
+    [[nodiscard]] auto band() const { return _ab(range(_kl, 2 * _kl + _ku + 1), range()); }
+
+    /// The element (i, j), 0 outside of the band
+    [[nodiscard]] T operator()(long i, long j) const { return (in_band(i, j) ? _ab(_kl + _ku + i - j, j) : T{0}); }
+
+    /// The element (i, j) of the band
+    [[nodiscard]] T &at(long i, long j) {
+      EXPECTS_WITH_MESSAGE(in_band(i, j), "band_matrix : (" << i << ", " << j << ") is outside of the band");
+      return _ab(_kl + _ku + i - j, j);
+    }
+
+    /// Write the full dense matrix into out, which must have the shape of the matrix
+    template <MemoryArrayOfRank<2> Out>
+    void to_dense(Out &&out) const {
+      EXPECTS_WITH_MESSAGE(out.shape() == shape(), "band_matrix::to_dense : shape mismatch " << out.shape() << " != " << shape());
+      out = 0;
+      for (long j = 0; j < _n; ++j)
+        for (long i = first_row(j); i <= last_row(j); ++i) out(i, j) = _ab(_kl + _ku + i - j, j);
+    }
+
+    /// The full dense matrix
+    [[nodiscard]] matrix<T> to_dense() const {
+      auto r = matrix<T>(_n, _n);
+      to_dense(r);
+      return r;
+    }
+
+    /// Product with a dense vector (blas gbmv), or with a dense matrix, column by column
+    template <Array X>
+    friend auto operator*(band_matrix const &a, X const &x) {
+      static_assert(get_rank<X> == 1 or get_rank<X> == 2, "band_matrix * x : x must be a vector or a matrix");
+      static_assert(std::is_same_v<get_value_t<X>, T>, "band_matrix * x : x must have the element type of the matrix");
+      EXPECTS_WITH_MESSAGE(x.shape()[0] == a.dim(), "band_matrix * x : dimension mismatch");
+      auto xx = make_regular(x);
+      if constexpr (get_rank<X> == 1) {
+        auto r = vector<T>(a.dim());
+        blas::gbmv(T{1}, a.band(), a.dim(), a.kl(), a.ku(), xx, T{0}, r);
+        return r;
+      } else {
+        auto r = matrix<T, F_layout>(a.dim(), xx.extent(1));
+        for (long j = 0; j < xx.extent(1); ++j) blas::gbmv(T{1}, a.band(), a.dim(), a.kl(), a.ku(), xx(range(), j), T{0}, r(range(), j));
+        return r;
+      }
+    }
+  };
+
+} // namespace nda
+
+namespace nda::linalg {
+
+  /**
+   * LU factorization A = P * L * U of a band matrix, computed once with lapack gbtrf.
+   *
+   * The factors are kept together with the pivots, so that A * X = B can be solved repeatedly with gbtrs,
+   * each solve costing O(n * (kl + ku)) per right hand side.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class band_lu_factorization {
+    static_assert(blas::is_blas_lapack_v<T>, "band_lu_factorization: element type must be a blas/lapack type");
+
+    // The factors, as returned by gbtrf
+    matrix<T, F_layout> _lu;
+
+    // The pivot indices (1-based, as in lapack)
+    array<int, 1> _ipiv;
+
+    long _kl = 0, _ku = 0;
+
+    // The info returned by gbtrf
+    int _info = 0;
+
+    void _factorize() {
+      _info = 0;
+      if (size() == 0) return;
+      _info = lapack::gbtrf(_lu, _kl, _ku, _ipiv);
+      if (_info < 0) NDA_RUNTIME_ERROR << "Error in band_lu_factorization : gbtrf info = " << _info;
+    }
+
+    public:
+    /// Factorize a copy of the band matrix a
+    explicit band_lu_factorization(band_matrix<T> const &a) : _lu(a.storage()), _kl(a.kl()), _ku(a.ku()) { _factorize(); }
+
+    /// Factorize a new band matrix, reusing the storage of the previous factorization if the size and bandwidths are unchanged
+    void factorize(band_matrix<T> const &a) {
+      _lu = a.storage();
+      _kl = a.kl();
+      _ku = a.ku();
+      _factorize();
+    }
+
+    /// Dimension of the factorized matrix
+    [[nodiscard]] int size() const { return _lu.extent(1); }
+
+    /// The factors, as computed by gbtrf, in the band storage
+    [[nodiscard]] matrix<T, F_layout> const &lu() const { return _lu; }
+
+    /// The pivot indices, as computed by gbtrf
+    [[nodiscard]] array<int, 1> const &ipiv() const { return _ipiv; }
+
+    /// The info returned by gbtrf. A positive value indicates an exactly singular matrix.
+    [[nodiscard]] int info() const { return _info; }
+
+    /// Is the factorized matrix exactly singular ?
+    [[nodiscard]] bool is_singular() const { return _info > 0; }
+
+    /// The determinant of the matrix, from the diagonal of U and the pivots
+    [[nodiscard]] T determinant() const {
+      auto det    = T{1};
+      int n_flips = 0;
+      for (int i = 0; i < size(); i++) {
+        det *= _lu(_kl + _ku, i);
+        if (_ipiv(i) != i + 1) ++n_flips;
+      }
+      return ((n_flips % 2 == 1) ? -det : det);
+    }
+
+    /**
+     * Solve A * X = B in place, B being overwritten by X.
+     *
+     * @param b A vector (one right hand side), a matrix (one right hand side per column)
+     *          or a rank 3 array of shape (n_batch, N, NRHS), each b(i, _, _) being solved.
+     *          Operands which are not lapack compatible are solved through a Fortran ordered copy.
+     */
+    template <MemoryArray B>
+    void solve_in_place(B &&b) const {
+      static_assert(std::is_same_v<get_value_t<B>, T>, "band_lu_factorization : the right hand side must have the same element type as the matrix");
+      if (is_singular()) NDA_RUNTIME_ERROR << "Error in band_lu_factorization : matrix is singular. gbtrf info = " << _info;
+
+      details::rhs_dispatch(b, size(), [this](T *b_ptr, int nrhs, int ldb) {
+        int info = 0;
+        lapack::f77::gbtrs('N', size(), _kl, _ku, nrhs, _lu.data(), blas::get_ld(_lu), _ipiv.data(), b_ptr, ldb, info);
+        if (info != 0) NDA_RUNTIME_ERROR << "Error in band_lu_factorization : gbtrs info = " << info;
+      });
+    }
+
+    /**
+     * Solve A * X = B
+     *
+     * @param b A vector, a matrix or a rank 3 array (batch of matrices), cf. solve_in_place
+     * @return The solution X, with the shape of b
+     */
+    template <Array B>
+    auto solve(B const &b) const {
+      auto x = basic_array<get_value_t<B>, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+      solve_in_place(x);
+      return x;
+    }
+  };
+
+  /// Deduction guide
+  template <typename T>
+  band_lu_factorization(band_matrix<T> const &) -> band_lu_factorization<T>;
+
+  /**
+   * Solve A * X = B for a band matrix A, in O(n * kl * (kl + ku)) operations.
+   * A vector or a matrix is solved in one call to lapack gbsv, a batch of matrices with a single band_lu_factorization.
+   *
+   * @param a The band matrix
+   * @param b A vector, a matrix or a rank 3 array (batch of matrices)
+   * @return The solution X, with the shape of b
+   */
+  template <typename T, Array B>
+  auto solve(band_matrix<T> const &a, B const &b) {
+    if constexpr (get_rank<B> == 3) {
+      return band_lu_factorization<T>{a}.solve(b);
+    } else {
+      static_assert(std::is_same_v<get_value_t<B>, T>, "solve : the right hand side must have the same element type as the matrix");
+      EXPECTS_WITH_MESSAGE(b.shape()[0] == a.dim(), "solve : dimension mismatch");
+      auto x = basic_array<get_value_t<B>, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+      if (x.size() == 0) return x;
+      auto ab   = matrix<T, F_layout>{a.storage()};
+      auto ipiv = array<int, 1>(a.dim());
+      int info  = lapack::gbsv(ab, a.kl(), a.ku(), ipiv, x);
+      if (info != 0) NDA_RUNTIME_ERROR << "Error in solve : the band matrix is singular. gbsv info = " << info;
+      return x;
+    }
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,282 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include <numeric>
+#include <vector>
+
+#include "./det_and_inverse.hpp"
+#include "./eigenelements.hpp"
+#include "./for_each_block.hpp"
+#include "./matmul.hpp"
+
+namespace nda {
+
+  /**
+   * Block diagonal matrix, with square blocks stored contiguously (each in C order) in a single buffer.
+   *
+   * Products, inverse, determinant and eigenelements are computed block by block,
+   * the blocks being distributed over the OpenMP threads (when compiled with OpenMP).
+   *
+   * The full dense matrix is available with to_dense(), and the block b is the
+   * sub matrix dense(block_range(b), block_range(b)).
+   *
+   * @tparam T Element type
+   */
+  template <typename T>
+  class block_matrix {
+    std::vector<long> _sizes;
+    std::vector<long> _offsets{0};      // Offset of the first row of each block in the full matrix, and the full dimension
+    std::vector<long> _data_offsets{0}; // Offset of each block in _data, and the total size
+    array<T, 1> _data;
+
+    void _init(std::vector<long> sizes) {
+      _sizes = std::move(sizes);
+      _offsets.resize(_sizes.size() + 1);
+      _data_offsets.resize(_sizes.size() + 1);
+      for (long b = 0; b < n_blocks(); ++b) {
+        EXPECTS_WITH_MESSAGE(_sizes[b] >= 0, "block_matrix : negative block size");
+        _offsets[b + 1]      = _offsets[b] + _sizes[b];
+        _data_offsets[b + 1] = _data_offsets[b] + _sizes[b] * _sizes[b];
+      }
+      _data.resize(_data_offsets.back());
+    }
+
+    public:
+    using value_type = T;
+
+    /// An empty matrix, with no blocks
+    block_matrix() = default;
+
+    /// Block diagonal matrix with the given block sizes. The elements are not initialized.
+    explicit block_matrix(std::vector<long> sizes) { _init(std::move(sizes)); }
+
+    /// Block diagonal matrix with the given blocks
+    template <ArrayOfRank<2> M>
+    explicit block_matrix(std::vector<M> const &blocks) {
+      std::vector<long> sizes(blocks.size());
+      for (long b = 0; b < sizes.size(); ++b) {
+        EXPECTS(is_matrix_square(blocks[b], true));
+        sizes[b] = blocks[b].shape()[0];
+      }
+      _init(std::move(sizes));
+      for (long b = 0; b < n_blocks(); ++b) block(b) = blocks[b];
+    }
+
+    /**
+     * Extract the diagonal blocks of a dense matrix. The off diagonal blocks are ignored.
+     *
+     * @param m The dense matrix (or view, or lazy expression)
+     * @param sizes The block sizes, summing to the dimension of m
+     */
+    template <ArrayOfRank<2> M>
+    block_matrix(M const &m, std::vector<long> sizes) {
+      _init(std::move(sizes));
+      EXPECTS_WITH_MESSAGE(m.shape()[0] == dim() and m.shape()[1] == dim(), "block_matrix : the block sizes do not match the dense matrix");
+      for (long b = 0; b < n_blocks(); ++b) block(b) = m(block_range(b), block_range(b));
+    }
+
+    /// A block matrix with the block sizes of x and all its elements set to zero
+    static block_matrix zeros_like(block_matrix const &x) {
+      auto r  = block_matrix{x._sizes};
+      r._data = 0;
+      return r;
+    }
+
+    /// Number of blocks
+    [[nodiscard]] long n_blocks() const { return _sizes.size(); }
+
+    /// The size of each block
+    [[nodiscard]] std::vector<long> const &block_sizes() const { return _sizes; }
+
+    /// Dimension of the full matrix
+    [[nodiscard]] long dim() const { return _offsets.back(); }
+
+    /// Shape of the full matrix
+    [[nodiscard]] std::array<long, 2> shape() const { return {dim(), dim()}; }
+
+    /// The range of rows (and columns) of the block b in the full matrix
+    [[nodiscard]] range block_range(long b) const { return {_offsets[b], _offsets[b + 1]}; }
+
+    /// The block b
+    [[nodiscard]] matrix_view<T> block(long b) { return {{_sizes[b], _sizes[b]}, _data.data() + _data_offsets[b]}; }
+
+    /// The block b
+    [[nodiscard]] matrix_const_view<T> block(long b) const { return {{_sizes[b], _sizes[b]}, _data.data() + _data_offsets[b]}; }
+
+    /// The contiguous storage of all the blocks
+    [[nodiscard]] array_view<T, 1> data() { return _data; }
+
+    /// The contiguous storage of all the blocks
+    [[nodiscard]] array_const_view<T, 1> data() const { return _data; }
+
+    /// Have x and y the same block structure ?
+    friend bool have_same_blocks(block_matrix const &x, block_matrix const &y) { return x._sizes == y._sizes; }
+
+    /// Write the full dense matrix into out, which must have the shape of the full matrix
+    template <MemoryArrayOfRank<2> Out>
+    void to_dense(Out &&out) const {
+      EXPECTS_WITH_MESSAGE(out.shape() == shape(), "block_matrix::to_dense : shape mismatch " << out.shape() << " != " << shape());
+      out = 0;
+      for (long b = 0; b < n_blocks(); ++b) out(block_range(b), block_range(b)) = block(b);
+    }
+
+    /// The full dense matrix
+    [[nodiscard]] matrix<T> to_dense() const {
+      auto r = matrix<T>(dim(), dim());
+      to_dense(r);
+      return r;
+    }
+
+    // ------------- Arithmetic ------------------
+
+    block_matrix &operator+=(block_matrix const &y) {
+      EXPECTS_WITH_MESSAGE(have_same_blocks(*this, y), "block_matrix : block structure mismatch");
+      _data += y._data;
+      return *this;
+    }
+
+    block_matrix &operator-=(block_matrix const &y) {
+      EXPECTS_WITH_MESSAGE(have_same_blocks(*this, y), "block_matrix : block structure mismatch");
+      _data -= y._data;
+      return *this;
+    }
+
+    block_matrix &operator*=(T const &s) {
+      _data *= s;
+      return *this;
+    }
+
+    friend block_matrix operator+(block_matrix x, block_matrix const &y) {
+      x += y;
+      return x;
+    }
+    friend block_matrix operator-(block_matrix x, block_matrix const &y) {
+      x -= y;
+      return x;
+    }
+    friend block_matrix operator*(block_matrix x, T const &s) {
+      x *= s;
+      return x;
+    }
+    friend block_matrix operator*(T const &s, block_matrix x) {
+      x *= s;
+      return x;
+    }
+
+    /// Block diagonal matrix product, computed block by block with gemm
+    friend block_matrix operator*(block_matrix const &x, block_matrix const &y) {
+      EXPECTS_WITH_MESSAGE(have_same_blocks(x, y), "block_matrix product : block structure mismatch");
+      auto r = block_matrix{x._sizes};
+      details::for_each_block(x._sizes, [&](long b) { matmul_into(r.block(b), x.block(b), y.block(b)); });
+      return r;
+    }
+
+    /// Block diagonal matrix * dense vector or matrix, computed block row by block row
+    template <Array X>
+    friend auto operator*(block_matrix const &x, X const &y) {
+      static_assert(get_rank<X> == 1 or get_rank<X> == 2, "block_matrix * y : y must be a vector or a matrix");
+      if constexpr (not MemoryArray<X>) {
+        // A lazy expression can not be sliced into block rows : evaluate it first
+        return x * make_regular(y);
+      } else {
+        EXPECTS_WITH_MESSAGE(y.shape()[0] == x.dim(), "block_matrix * y : dimension mismatch");
+        using promoted_type = decltype(T{} * get_value_t<X>{});
+        if constexpr (get_rank<X> == 1) {
+          auto r = vector<promoted_type>(x.dim());
+          details::for_each_block(x._sizes, [&](long b) { matvecmul_into(r(x.block_range(b)), x.block(b), y(x.block_range(b))); });
+          return r;
+        } else {
+          auto r = matrix<promoted_type>(x.dim(), y.shape()[1]);
+          details::for_each_block(x._sizes, [&](long b) { matmul_into(r(x.block_range(b), range()), x.block(b), y(x.block_range(b), range())); });
+          return r;
+        }
+      }
+    }
+  };
+
+  // ----------  inverse and determinant -------------------------
+
+  /// Invert all the blocks in place
+  template <typename T>
+  void inverse_in_place(block_matrix<T> &m) {
+    details::for_each_block(m.block_sizes(), [&m](long b) { inverse_in_place(m.block(b)); });
+  }
+
+  /// The inverse of a block diagonal matrix, computed block by block
+  template <typename T>
+  block_matrix<T> inverse(block_matrix<T> const &m) {
+    auto r = m;
+    inverse_in_place(r);
+    return r;
+  }
+
+  /// The determinant of a block diagonal matrix, the product of the determinants of the blocks
+  template <typename T>
+  auto determinant(block_matrix<T> const &m) {
+    auto dets = std::vector<T>(m.n_blocks(), T{1});
+    details::for_each_block(m.block_sizes(), [&](long b) {
+      auto blk = matrix<T>{m.block(b)};
+      dets[b]  = determinant_in_place(blk);
+    });
+    return std::accumulate(dets.begin(), dets.end(), T{1}, std::multiplies<>{});
+  }
+
+} // namespace nda
+
+namespace nda::linalg {
+
+  /**
+   * Find the eigenvalues and eigenvectors of a symmetric(real) or hermitian(complex) block diagonal matrix, block by block.
+   * On return, each block of m contains its eigenvectors as columns.
+   *
+   * @param m The block matrix
+   * @return The eigenvalues, block by block (sorted in ascending order within each block only)
+   */
+  template <typename T>
+  array<blas::real_value_t<T>, 1> eigenelements_in_place(block_matrix<T> &m) {
+    auto ev = array<blas::real_value_t<T>, 1>(m.dim());
+    nda::details::for_each_block(m.block_sizes(), [&](long b) {
+      ev(m.block_range(b)) = _eigen_element_impl(m.block(b), 'V');
+    });
+    return ev;
+  }
+
+  /**
+   * Find the eigenvalues and eigenvectors of a symmetric(real) or hermitian(complex) block diagonal matrix, block by block.
+   * @return Pair consisting of the eigenvalues (block by block, cf. eigenelements_in_place)
+   *         and the block matrix containing the eigenvectors as columns
+   */
+  template <typename T>
+  std::pair<array<blas::real_value_t<T>, 1>, block_matrix<T>> eigenelements(block_matrix<T> const &m) {
+    auto vecs = m;
+    auto ev   = eigenelements_in_place(vecs);
+    return {std::move(ev), std::move(vecs)};
+  }
+
+  /// The eigenvalues of a symmetric(real) or hermitian(complex) block diagonal matrix, block by block
+  template <typename T>
+  array<blas::real_value_t<T>, 1> eigenvalues(block_matrix<T> const &m) {
+    auto ev = array<blas::real_value_t<T>, 1>(m.dim());
+    nda::details::for_each_block(m.block_sizes(), [&](long b) {
+      auto blk             = matrix<T>{m.block(b)};
+      ev(m.block_range(b)) = _eigen_element_impl(blk, 'N');
+    });
+    return ev;
+  }
+
+} // namespace nda::linalg
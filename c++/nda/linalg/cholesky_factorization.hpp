@@ -0,0 +1,168 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include "../lapack.hpp"
+#include "./det_and_inverse.hpp"
+#include "./rhs_dispatch.hpp"
+
+namespace nda::linalg {
+
+  /**
+   * Cholesky factorization A = U^H * U of a symmetric (real) or hermitian (complex) positive definite matrix,
+   * computed once with lapack potrf.
+   *
+   * A * X = B can then be solved repeatedly with potrs, at half the cost of the LU path.
+   * Only the upper triangle of A is referenced.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   * @tparam Layout Memory layout of the factor.
+   *         In C order, lapack factorizes the complex conjugate of A, and the right hand sides are conjugated on the fly.
+   */
+  template <typename T, typename Layout = F_layout>
+  class cholesky_factorization {
+    static_assert(blas::is_blas_lapack_v<T>, "cholesky_factorization: element type must be a blas/lapack type");
+
+    using matrix_t = matrix<T, Layout>;
+
+    // In C order, lapack sees the transpose of the matrix, i.e. its complex conjugate
+    static constexpr bool conjugated = is_complex_v<T> and matrix_t::is_stride_order_C();
+
+    // The triangle referenced by lapack, such that the upper triangle of A is used in both orders
+    static constexpr char uplo = (matrix_t::is_stride_order_C() ? 'L' : 'U');
+
+    // The Cholesky factor, as returned by potrf
+    matrix_t _chol;
+
+    // The info returned by potrf
+    int _info = 0;
+
+    void _factorize() {
+      EXPECTS(is_matrix_square(_chol, true));
+      _info = 0;
+      if (_chol.empty()) return;
+      _info = lapack::potrf(_chol, uplo);
+      if (_info < 0) NDA_RUNTIME_ERROR << "Error in cholesky_factorization : potrf info = " << _info;
+    }
+
+    public:
+    /// Factorize a copy of the matrix a
+    template <ArrayOfRank<2> A>
+    explicit cholesky_factorization(A const &a) : _chol(a) {
+      _factorize();
+    }
+
+    /// Factorize the matrix a in place, taking ownership of its storage (no copy)
+    explicit cholesky_factorization(matrix_t &&a) : _chol(std::move(a)) { _factorize(); }
+
+    /// Factorize a new matrix, reusing the storage of the previous factorization if the size is unchanged
+    template <ArrayOfRank<2> A>
+    void factorize(A const &a) {
+      _chol = a;
+      _factorize();
+    }
+
+    /// Dimension of the factorized matrix
+    [[nodiscard]] int size() const { return _chol.extent(0); }
+
+    /// The Cholesky factor, as computed by potrf. Only the upper triangle (seen in Fortran order) is meaningful.
+    [[nodiscard]] matrix_t const &factor() const { return _chol; }
+
+    /// The info returned by potrf. A positive value indicates that the matrix is not positive definite.
+    [[nodiscard]] int info() const { return _info; }
+
+    /// Was the factorized matrix positive definite ?
+    [[nodiscard]] bool is_positive_definite() const { return _info == 0; }
+
+    /// The determinant of the matrix, from the diagonal of the factor
+    [[nodiscard]] double determinant() const {
+      double det = 1.0;
+      for (int i = 0; i < size(); ++i) det *= std::real(_chol(i, i)) * std::real(_chol(i, i));
+      return det;
+    }
+
+    /// The logarithm of the determinant of the matrix, without overflow for large matrices
+    [[nodiscard]] double log_determinant() const {
+      double r = 0.0;
+      for (int i = 0; i < size(); ++i) r += 2 * std::log(std::real(_chol(i, i)));
+      return r;
+    }
+
+    /// The inverse of the matrix, computed from the factor with potri
+    [[nodiscard]] matrix_t inverse() const {
+      if (not is_positive_definite()) NDA_RUNTIME_ERROR << "Error in cholesky_factorization : matrix not positive definite. potrf info = " << _info;
+      auto r = _chol;
+      if (r.empty()) return r;
+      int info = lapack::potri(r, uplo);
+      if (info != 0) NDA_RUNTIME_ERROR << "Error in cholesky_factorization : potri info = " << info;
+
+      // potri only computes the upper triangle of the inverse. Complete the lower one.
+      for (int i = 0; i < size(); ++i)
+        for (int j = 0; j < i; ++j) r(i, j) = conj(r(j, i));
+      return r;
+    }
+
+    /**
+     * Solve A * X = B in place, B being overwritten by X.
+     *
+     * @param b A vector (one right hand side), a matrix (one right hand side per column)
+     *          or a rank 3 array of shape (n_batch, N, NRHS), each b(i, _, _) being solved.
+     *          Operands which are not lapack compatible are solved through a Fortran ordered copy.
+     */
+    template <MemoryArray B>
+    void solve_in_place(B &&b) const {
+      static_assert(std::is_same_v<get_value_t<B>, T>, "cholesky_factorization : the right hand side must have the same element type as the matrix");
+      if (not is_positive_definite()) NDA_RUNTIME_ERROR << "Error in cholesky_factorization : matrix not positive definite. potrf info = " << _info;
+
+      details::rhs_dispatch(b, size(), [this](T *b_ptr, int nrhs, int ldb) {
+        // conj(A) * conj(X) = conj(B)
+        auto conj_b = [&]() {
+          for (long j = 0; j < nrhs; ++j)
+            for (long i = 0; i < size(); ++i) b_ptr[i + j * ldb] = conj(b_ptr[i + j * ldb]);
+        };
+        if constexpr (conjugated) conj_b();
+        int info = 0;
+        lapack::f77::potrs(uplo, size(), nrhs, _chol.data(), blas::get_ld(_chol), b_ptr, ldb, info);
+        if (info != 0) NDA_RUNTIME_ERROR << "Error in cholesky_factorization : potrs info = " << info;
+        if constexpr (conjugated) conj_b();
+      });
+    }
+
+    /**
+     * Solve A * X = B
+     *
+     * @param b A vector, a matrix or a rank 3 array (batch of matrices), cf. solve_in_place
+     * @return The solution X, with the shape of b
+     */
+    template <Array B>
+    auto solve(B const &b) const {
+      // For matrices, use Fortran order directly to avoid a copy in and out of lapack
+      auto x = basic_array<get_value_t<B>, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+      solve_in_place(x);
+      return x;
+    }
+  };
+
+  /// Deduction guide : factorize a copy of any matrix or rank 2 array in Fortran order
+  template <ArrayOfRank<2> A>
+  cholesky_factorization(A const &) -> cholesky_factorization<get_value_t<A>>;
+
+  /// Deduction guide : factorize a regular matrix in place
+  template <typename T, typename Layout>
+  cholesky_factorization(matrix<T, Layout> &&) -> cholesky_factorization<T, Layout>;
+
+} // namespace nda::linalg
@@ -0,0 +1,229 @@
+// Copyright (c) 2019-2020 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include "../layout_transforms.hpp"
+#include "../blas/gemm.hpp"
+
+namespace nda {
+
+  namespace details {
+
+    // The specification of a contraction, e.g. "ijkl,klmn->ijmn", usable as a template parameter
+    template <size_t N>
+    struct contraction_spec {
+      char str[N] = {};
+
+      constexpr contraction_spec(char const (&s)[N]) { // NOLINT : implicit conversion from the literal is intended
+        for (size_t i = 0; i < N; ++i) str[i] = s[i];
+      }
+
+      [[nodiscard]] constexpr std::string_view view() const { return {str, N - 1}; }
+
+      [[nodiscard]] constexpr bool is_well_formed() const {
+        auto comma = view().find(','), arrow = view().find("->");
+        return (comma != std::string_view::npos) and (arrow != std::string_view::npos) and (comma < arrow);
+      }
+
+      // The labels of the indices of the operand n : 0 for the lhs, 1 for the rhs, 2 for the result
+      [[nodiscard]] constexpr std::string_view labels(int n) const {
+        auto comma = view().find(','), arrow = view().find("->");
+        if (n == 0) return view().substr(0, comma);
+        if (n == 1) return view().substr(comma + 1, arrow - comma - 1);
+        return view().substr(arrow + 2);
+      }
+    };
+
+    // A small set of index labels (an nda array has at most 16 indices)
+    struct labels_t {
+      char str[16] = {};
+      int size     = 0;
+      [[nodiscard]] constexpr std::string_view view() const { return {str, size_t(size)}; }
+    };
+
+    // The labels of x which are in y (in_y = true) or not in y (in_y = false), in the order of x
+    constexpr labels_t labels_filter(std::string_view x, std::string_view y, bool in_y) {
+      labels_t r;
+      for (char c : x)
+        if ((y.find(c) != std::string_view::npos) == in_y) r.str[r.size++] = c;
+      return r;
+    }
+
+    constexpr bool labels_are_unique(std::string_view x) {
+      for (size_t u = 0; u < x.size(); ++u)
+        if (x.find(x[u], u + 1) != std::string_view::npos) return false;
+      return true;
+    }
+
+    // The positions in x of the labels l
+    template <size_t M>
+    constexpr std::array<int, M> label_positions(std::string_view x, std::string_view l) {
+      std::array<int, M> r{};
+      for (size_t u = 0; u < M; ++u) r[u] = int(x.find(l[u]));
+      return r;
+    }
+
+    template <size_t M1, size_t M2>
+    constexpr std::array<int, M1 + M2> concat(std::array<int, M1> const &a1, std::array<int, M2> const &a2) {
+      std::array<int, M1 + M2> r{};
+      for (size_t u = 0; u < M1; ++u) r[u] = a1[u];
+      for (size_t u = 0; u < M2; ++u) r[M1 + u] = a2[u];
+      return r;
+    }
+
+    // Length and stride of the index obtained by merging the indices grp of the idx_map, in this order (grp[0] being the slowest).
+    // They can be merged without a copy iff each index is nested in the previous one in memory. Indices of length 1 are ignored.
+    // A stride 0 means that the merged index has length 1, and any stride can be chosen.
+    template <typename IdxMap, size_t M>
+    std::optional<std::pair<long, long>> merged_index(IdxMap const &idxm, std::array<int, M> const &grp) {
+      long len = 1, stride = 0, expected = 0;
+      for (int u = int(M) - 1; u >= 0; --u) {
+        long l = idxm.lengths()[grp[u]], s = idxm.strides()[grp[u]];
+        if (l == 1) continue;
+        if (stride == 0)
+          stride = s;
+        else if (s != expected)
+          return {};
+        expected = s * l;
+        len *= l;
+      }
+      return std::pair{len, stride};
+    }
+
+    // Call f with a matrix view of shape (r.first, c.first), strides (r.second, c.second) on the data p.
+    // The layout of the view follows the order of the strides, as the stride order is part of the type.
+    template <typename T, typename F>
+    void with_matrix_view(T *p, std::pair<long, long> r, std::pair<long, long> c, F const &f) {
+      if (r.second == 0) r.second = std::max(c.first * c.second, 1l);
+      if (c.second == 0) c.second = (r.first == 1 ? 1 : r.first * r.second);
+      if (r.second >= c.second)
+        f(matrix_view<T, C_stride_layout>{typename C_stride_layout::template mapping<2>{{r.first, c.first}, {r.second, c.second}}, p});
+      else
+        f(matrix_view<T, F_stride_layout>{typename F_stride_layout::template mapping<2>{{r.first, c.first}, {r.second, c.second}}, p});
+    }
+
+    // Call f with the matrix view of x whose rows are the merged indices G1 and the columns the merged indices G2.
+    // If the indices can not be merged in place, x is first transposed into a contiguous array, with the indices in the order (G1, G2).
+    template <auto G1, auto G2, typename X, typename F>
+    void with_merged_matrix_view(X const &x, F const &f) {
+      auto r = merged_index(x.indexmap(), G1), c = merged_index(x.indexmap(), G2);
+      if (r and c) return with_matrix_view(x.data(), *r, *c, f);
+
+      static constexpr auto perm = permutations::inverse(concat(G1, G2));
+      auto x_t                   = array<std::remove_const_t<get_value_t<X>>, get_rank<X>>{permuted_indices_view<encode(perm)>(x)};
+      long n_rows                = std::accumulate(x_t.shape().begin(), x_t.shape().begin() + G1.size(), 1l, std::multiplies<>{});
+      long n_cols                = x_t.size() / n_rows;
+      with_matrix_view(std::as_const(x_t).data(), {n_rows, n_cols}, {n_cols, 1}, f);
+    }
+
+  } // namespace details
+
+  /**
+   * Contraction of two arrays, specified with index labels as in einsum.
+   *
+   * E.g. contract<"ijkl,klmn->ijmn">(a, b) returns the array of rank 4 r(i,j,m,n) = sum_{k,l} a(i,j,k,l) b(k,l,m,n).
+   *
+   * The contraction is computed as one matrix product (gemm) : the free indices of a, the contracted indices
+   * and the free indices of b are merged into the indices of matrices.
+   *   * When the strides allow it, the indices are merged in place, without any copy (the matrices may be transposed).
+   *   * Otherwise, the operand (or the result) is first transposed into a contiguous temporary
+   *     with its indices in the required order.
+   * The contracted indices are merged in the order of their labels in a, e.g. "kl" for "ijkl,lkmn->ijmn".
+   *
+   * @tparam Spec The contraction, as "<labels of a>,<labels of b>-><labels of the result>".
+   *         Each label appears exactly once in a or b, and in the result iff it is not contracted.
+   *         Batch indices (present in a, b and the result) are not supported.
+   * @param a An array, or a lazy expression (which is then evaluated)
+   * @param b An array, or a lazy expression (which is then evaluated)
+   * @return The result, as a regular array in C order
+   */
+  template <details::contraction_spec Spec, Array A, Array B>
+  auto contract(A const &a, B const &b) {
+    using T = decltype(get_value_t<A>{} * get_value_t<B>{});
+
+    // Evaluate lazy expressions and convert to the promoted type first
+    if constexpr (not MemoryArray<A> or not std::is_same_v<std::remove_const_t<get_value_t<A>>, T>) {
+      return contract<Spec>(array<T, get_rank<A>>{a}, b);
+    } else if constexpr (not MemoryArray<B> or not std::is_same_v<std::remove_const_t<get_value_t<B>>, T>) {
+      return contract<Spec>(a, array<T, get_rank<B>>{b});
+    } else {
+
+      static_assert(Spec.is_well_formed(), "contract : the specification must be of the form \"ijkl,klmn->ijmn\"");
+      static constexpr auto la = Spec.labels(0), lb = Spec.labels(1), lc = Spec.labels(2);
+      static_assert(la.size() == get_rank<A>, "contract : the number of labels of the first operand must be its rank");
+      static_assert(lb.size() == get_rank<B>, "contract : the number of labels of the second operand must be its rank");
+      static_assert(details::labels_are_unique(la) and details::labels_are_unique(lb) and details::labels_are_unique(lc),
+                    "contract : repeated labels (traces, diagonals) are not supported");
+
+      // I : free indices of a, J : free indices of b, both in the order of the result. K : contracted indices, in the order of a.
+      static constexpr auto I = details::labels_filter(lc, la, true);
+      static constexpr auto J = details::labels_filter(lc, lb, true);
+      static constexpr auto K = details::labels_filter(la, lc, false);
+      static_assert(I.size + J.size == lc.size(), "contract : each label of the result must appear in exactly one of the operands");
+      static_assert(details::labels_filter(lb, lc, false).size == K.size and details::labels_filter(K.view(), lb, true).size == K.size,
+                    "contract : a label not in the result must appear in both operands");
+
+      static constexpr int NI = I.size, NJ = J.size, NK = K.size, RC = lc.size();
+      static_assert(RC > 0, "contract : the result must have at least one index");
+      static constexpr auto a_I = details::label_positions<NI>(la, I.view()), a_K = details::label_positions<NK>(la, K.view());
+      static constexpr auto b_K = details::label_positions<NK>(lb, K.view()), b_J = details::label_positions<NJ>(lb, J.view());
+      static constexpr auto c_I = details::label_positions<NI>(lc, I.view()), c_J = details::label_positions<NJ>(lc, J.view());
+
+      // The shape of the result
+      std::array<long, RC> shape{};
+      for (int u = 0; u < NI; ++u) shape[c_I[u]] = a.shape()[a_I[u]];
+      for (int u = 0; u < NJ; ++u) shape[c_J[u]] = b.shape()[b_J[u]];
+      for (int u = 0; u < NK; ++u)
+        EXPECTS_WITH_MESSAGE(a.shape()[a_K[u]] == b.shape()[b_K[u]], "contract : dimension mismatch for the contracted label " << K.str[u]);
+
+      auto res = array<T, RC>(shape);
+      if (res.empty()) return res;
+      if (a.empty()) {
+        res = 0;
+        return res;
+      }
+
+      auto gemm = [](auto const &am, auto const &bm, auto &&cm) {
+        if constexpr (blas::is_blas_lapack_v<T>)
+          blas::gemm(T{1}, am, bm, T{0}, cm);
+        else
+          blas::gemm_generic(T{1}, am, bm, T{0}, cm);
+      };
+
+      // The result as the matrix (I, J). If its indices can not be merged in place, it is computed in the order (I, J) and transposed.
+      auto r = details::merged_index(res.indexmap(), c_I), c = details::merged_index(res.indexmap(), c_J);
+      details::with_merged_matrix_view<a_I, a_K>(a, [&](auto const &am) {
+        details::with_merged_matrix_view<b_K, b_J>(b, [&](auto const &bm) {
+          if (r and c) {
+            details::with_matrix_view(res.data(), *r, *c, [&](auto cm) { gemm(am, bm, cm); });
+          } else {
+            static constexpr auto src = details::concat(c_I, c_J);
+            std::array<long, RC> shape_t{};
+            for (int u = 0; u < RC; ++u) shape_t[u] = shape[src[u]];
+            auto res_t = array<T, RC>(shape_t);
+            gemm(am, bm, matrix_view<T>{{am.extent(0), bm.extent(1)}, res_t.data()});
+            res = permuted_indices_view<encode(src)>(res_t);
+          }
+        });
+      });
+      return res;
+    }
+  }
+
+} // namespace nda
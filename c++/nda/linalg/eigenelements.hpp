@@ -15,26 +15,50 @@
 // Authors: Olivier Parcollet, Nils Wentzell
 
 #pragma once
-#include "../lapack/interface/lapack_cxx_interface.hpp"
+#include <tuple>
+#include "../lapack.hpp"
 
 namespace nda::linalg {
 
+  namespace details {
+
+    // Take the adjoint of the square matrix m in place
+    template <typename M>
+    void adjoint_in_place(M &&m) {
+      using T = get_value_t<M>;
+      for (long i = 0; i < m.extent(0); ++i) {
+        for (long j = 0; j < i; ++j) {
+          auto tmp = m(i, j);
+          m(i, j)  = conj(m(j, i));
+          m(j, i)  = conj(tmp);
+        }
+        if constexpr (is_complex_v<T>) m(i, i) = std::conj(m(i, i));
+      }
+    }
+
+  } // namespace details
+
   template <typename M>
   // dispatch the implementation of invoke for T = double or complex
   auto _eigen_element_impl(M &&m, char compz) {
 
     EXPECTS((not m.empty()));
     EXPECTS(is_matrix_square(m, true));
-    EXPECTS(m.indexmap().is_contiguous());
+    EXPECTS(m.indexmap().min_stride() == 1);
 
     int dim = m.extent(0);
 
     using T = typename std::decay_t<M>::value_type;
+    using R = blas::real_value_t<T>;
+
+    // In C order, lapack sees the transpose of m, i.e. its complex conjugate as m is hermitian.
+    // Reading the lower triangle of the transpose amounts to reading the upper triangle of m.
+    char uplo = (std::decay_t<M>::is_stride_order_C() ? 'L' : 'U');
 
-    array<double, 1> ev(dim);
+    array<R, 1> ev(dim);
     int lwork = 64 * dim;
     array<T, 1> work(lwork);
-    array<double, 1> work2(is_complex_v<T> ? lwork : 0);
+    array<R, 1> work2(is_complex_v<T> ? lwork : 0);
 
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
@@ -46,11 +70,15 @@ namespace nda::linalg {
 
     int info = 0;
     if constexpr (not is_complex_v<T>) {
-      lapack::f77::syev(compz, 'U', dim, m.data(), dim, ev.data(), work.data(), lwork, info);
+      lapack::f77::syev(compz, uplo, dim, m.data(), blas::get_ld(m), ev.data(), work.data(), lwork, info);
     } else {
-      lapack::f77::heev(compz, 'U', dim, m.data(), dim, ev.data(), work.data(), lwork, work2.data(), info);
+      lapack::f77::heev(compz, uplo, dim, m.data(), blas::get_ld(m), ev.data(), work.data(), lwork, work2.data(), info);
     }
     if (info) NDA_RUNTIME_ERROR << "Diagonalization error";
+
+    // In C order, the eigenvectors of the transpose are now stored in the rows of m.
+    // Take the adjoint in place to obtain the eigenvectors of m as columns.
+    if (compz == 'V' and std::decay_t<M>::is_stride_order_C()) details::adjoint_in_place(m);
     return ev;
   }
 
@@ -58,15 +86,44 @@ namespace nda::linalg {
 
   /**
    * Find the eigenvalues and eigenvectors of a symmetric(real) or hermitian(complex) matrix.
-   * Requires an additional copy when M is stored in C memory order
+   * Perform the operation in-place, avoiding a copy of the matrix.
+   * On return, m contains the eigenvectors as columns.
+   * @param m The matrix or view (C or Fortran memory order, with unit smallest stride)
+   * @return The array of eigenvalues
+   */
+  template <MemoryArrayOfRank<2> M>
+  auto eigenelements_in_place(M &&m) {
+    return _eigen_element_impl(m, 'V');
+  }
+
+  //--------------------------------
+
+  /**
+   * Find the eigenvalues and eigenvectors of a symmetric(real) or hermitian(complex) matrix.
+   * The eigenvectors are written into the caller-supplied matrix or view, avoiding any allocation of a matrix.
+   * @param m The matrix or view.
+   * @param vecs Matrix or view of the same shape as m (C or Fortran memory order), receiving the eigenvectors as columns
+   * @return The array of eigenvalues
+   */
+  template <ArrayOfRank<2> M, MemoryArrayOfRank<2> V>
+  auto eigenelements(M const &m, V &&vecs) {
+    EXPECTS(m.shape() == vecs.shape());
+    vecs = m;
+    return _eigen_element_impl(vecs, 'V');
+  }
+
+  //--------------------------------
+
+  /**
+   * Find the eigenvalues and eigenvectors of a symmetric(real) or hermitian(complex) matrix.
    * @param M The matrix or view.
    * @return Pair consisting of the array of eigenvalues and the matrix containing the eigenvectors as columns
    */
-  template <typename M>
-  std::pair<array<double, 1>, typename M::regular_type> eigenelements(M const &m) {
-    auto m_copy = matrix<typename M::value_type, F_layout>(m);
+  template <ArrayOfRank<2> M>
+  std::pair<array<blas::real_value_t<get_value_t<M>>, 1>, typename M::regular_type> eigenelements(M const &m) {
+    auto m_copy = typename M::regular_type{m};
     auto ev     = _eigen_element_impl(m_copy, 'V');
-    return {ev, m_copy};
+    return {ev, std::move(m_copy)};
   }
 
   //--------------------------------
@@ -77,8 +134,8 @@ namespace nda::linalg {
    * @return The array of eigenvalues
    */
   template <typename M>
-  array<double, 1> eigenvalues(M const &m) {
-    auto m_copy = matrix<typename M::value_type, F_layout>(m);
+  auto eigenvalues(M const &m) {
+    auto m_copy = make_regular(m);
     return _eigen_element_impl(m_copy, 'N');
   }
 
@@ -88,12 +145,296 @@ namespace nda::linalg {
    * Find the eigenvalues of a symmetric(real) or hermitian(complex) matrix.
    * Perform the operation in-place, avoiding a copy of the matrix,
    * but invalidating its contents.
-   * @param M The matrix or view (must be contiguous and Fortran memory order)
+   * @param M The matrix or view (C or Fortran memory order, with unit smallest stride)
    * @return The array of eigenvalues
    */
-  template <typename M>
-  array<double, 1> eigenvalues_in_place(M *&m) {
+  template <MemoryArrayOfRank<2> M>
+  auto eigenvalues_in_place(M &&m) {
     return _eigen_element_impl(m, 'N');
   }
 
+  //--------------------------------
+  // General (non hermitian) matrices
+  //--------------------------------
+
+  namespace details {
+
+    // Copy the eigenvectors v computed by geev into the complex matrix out, conjugated if conjugate.
+    // For real matrices, the conjugate pairs packed by lapack in the columns j, j + 1 are unpacked.
+    template <typename V, typename W, typename Out>
+    void unpack_geev_vectors(V const &v, W const &w, Out &out, bool conjugate) {
+      using T = get_value_t<V>;
+      long n  = v.extent(0);
+      if constexpr (is_regular_v<std::decay_t<Out>>) {
+        if (out.extent(0) != n or out.extent(1) != n) out.resize(n, n);
+      }
+      EXPECTS(out.extent(0) == n and out.extent(1) == n);
+      auto cj = [conjugate](auto z) { return (conjugate ? conj(z) : z); };
+      for (long j = 0; j < n; ++j) {
+        if constexpr (not is_complex_v<T>) {
+          if (w(j).imag() > 0 and j + 1 < n) {
+            for (long i = 0; i < n; ++i) {
+              auto z        = cj(std::complex<T>{v(i, j), v(i, j + 1)});
+              out(i, j)     = z;
+              out(i, j + 1) = std::conj(z);
+            }
+            ++j;
+            continue;
+          }
+        }
+        for (long i = 0; i < n; ++i) out(i, j) = cj(v(i, j));
+      }
+    }
+
+    // Eigenvalues w and eigenvectors of the square matrix m, destroyed by the operation.
+    // vl, vr are the left and right eigenvectors, or nullptr if they are not needed.
+    // In C order, lapack sees the transpose of m : its right (left) eigenvectors are the conjugates of the left (right) ones of m.
+    template <typename M, typename W, typename VL, typename VR>
+    void general_eigen_impl(M &&m, W &&w, VL &&vl, VR &&vr, lapack::eigen_workspace<get_value_t<M>> &ws) {
+      using T                   = get_value_t<M>;
+      constexpr bool left       = not std::is_same_v<std::decay_t<VL>, std::nullptr_t>;
+      constexpr bool right      = not std::is_same_v<std::decay_t<VR>, std::nullptr_t>;
+      constexpr bool transposed = std::decay_t<M>::is_stride_order_C();
+      static_assert(blas::is_blas_lapack_v<T>, "general eigenelements : element type must be a blas/lapack type");
+      EXPECTS(is_matrix_square(m, true));
+      EXPECTS(m.indexmap().min_stride() == 1);
+
+      // the eigenvectors computed by lapack, in Fortran order, in the workspace. Only those requested are allocated.
+      long n            = m.extent(0);
+      bool lapack_left  = (transposed ? right : left);
+      bool lapack_right = (transposed ? left : right);
+      auto v1           = lapack::details::reserve_workspace(ws.v1, lapack_left ? n : 0);
+      auto v2           = lapack::details::reserve_workspace(ws.v2, lapack_right ? n : 0);
+
+      int info = 0;
+      if constexpr (transposed)
+        info = lapack::geev(transpose(m), w, v1, v2, (lapack_left ? 'V' : 'N'), (lapack_right ? 'V' : 'N'), ws);
+      else
+        info = lapack::geev(m, w, v1, v2, (lapack_left ? 'V' : 'N'), (lapack_right ? 'V' : 'N'), ws);
+      if (info != 0) NDA_RUNTIME_ERROR << "Error in general eigenelements : the QR algorithm failed to converge. geev info = " << info;
+
+      if constexpr (left) unpack_geev_vectors((transposed ? v2 : v1), w, vl, transposed);
+      if constexpr (right) unpack_geev_vectors((transposed ? v1 : v2), w, vr, transposed);
+    }
+
+    // The complex eigenvalue array of a matrix with element type T
+    template <typename T>
+    using eigenvalue_array_t = array<std::complex<blas::real_value_t<T>>, 1>;
+
+  } // namespace details
+
+  /**
+   * Eigenvalues of a general (non hermitian) square matrix, with lapack geev.
+   * Perform the operation in place, avoiding a copy of the matrix, but invalidating its contents.
+   *
+   * @param m The matrix or view (C or Fortran memory order, with unit smallest stride)
+   * @return The complex eigenvalues, in the order of lapack (not sorted)
+   */
+  template <MemoryArrayOfRank<2> M>
+  auto general_eigenvalues_in_place(M &&m) {
+    auto w  = details::eigenvalue_array_t<get_value_t<M>>(m.extent(0));
+    auto ws = lapack::eigen_workspace<get_value_t<M>>{};
+    details::general_eigen_impl(m, w, nullptr, nullptr, ws);
+    return w;
+  }
+
+  /**
+   * Eigenvalues and right eigenvectors of a general (non hermitian) square matrix, with lapack geev :
+   *  m * vr(_, j) = w(j) * vr(_, j), the eigenvectors being normalized to unit norm.
+   * Perform the operation in place, avoiding a copy of the matrix, but invalidating its contents.
+   * The outputs are resized only if their shape changes, so that they can be reused from one call to the next.
+   *
+   * @param m The matrix or view (C or Fortran memory order, with unit smallest stride)
+   * @param w The complex eigenvalues, in the order of lapack. Resized if necessary.
+   * @param vr Complex matrix or view receiving the right eigenvectors as columns. Resized if necessary.
+   * @param ws The workspace of lapack, reused from one call to the next : the calls with the same dimension do not allocate
+   */
+  template <MemoryArrayOfRank<2> M, MemoryArrayOfRank<1> W, MemoryArrayOfRank<2> VR>
+  void general_eigenelements_in_place(M &&m, W &&w, VR &&vr, lapack::eigen_workspace<get_value_t<M>> &ws) {
+    details::general_eigen_impl(m, w, nullptr, vr, ws);
+  }
+
+  /// Eigenvalues and right eigenvectors of a general square matrix, with a workspace allocated for this call only, cf. above
+  template <MemoryArrayOfRank<2> M, MemoryArrayOfRank<1> W, MemoryArrayOfRank<2> VR>
+  void general_eigenelements_in_place(M &&m, W &&w, VR &&vr) {
+    auto ws = lapack::eigen_workspace<get_value_t<M>>{};
+    details::general_eigen_impl(m, w, nullptr, vr, ws);
+  }
+
+  /**
+   * Eigenvalues, left and right eigenvectors of a general (non hermitian) square matrix, with lapack geev :
+   *  m * vr(_, j) = w(j) * vr(_, j) and vl(_, j)^H * m = w(j) * vl(_, j)^H, cf. general_eigenelements_in_place.
+   *
+   * @param m The matrix or view (C or Fortran memory order, with unit smallest stride), destroyed by the operation
+   * @param w The complex eigenvalues, in the order of lapack. Resized if necessary.
+   * @param vl Complex matrix or view receiving the left eigenvectors as columns. Resized if necessary.
+   * @param vr Complex matrix or view receiving the right eigenvectors as columns. Resized if necessary.
+   * @param ws The workspace of lapack, reused from one call to the next
+   */
+  template <MemoryArrayOfRank<2> M, MemoryArrayOfRank<1> W, MemoryArrayOfRank<2> VL, MemoryArrayOfRank<2> VR>
+  void general_eigenelements_in_place(M &&m, W &&w, VL &&vl, VR &&vr, lapack::eigen_workspace<get_value_t<M>> &ws) {
+    details::general_eigen_impl(m, w, vl, vr, ws);
+  }
+
+  /// Eigenvalues, left and right eigenvectors of a general square matrix, with a workspace allocated for this call only, cf. above
+  template <MemoryArrayOfRank<2> M, MemoryArrayOfRank<1> W, MemoryArrayOfRank<2> VL, MemoryArrayOfRank<2> VR>
+  void general_eigenelements_in_place(M &&m, W &&w, VL &&vl, VR &&vr) {
+    auto ws = lapack::eigen_workspace<get_value_t<M>>{};
+    details::general_eigen_impl(m, w, vl, vr, ws);
+  }
+
+  /**
+   * Eigenvalues of a general (non hermitian) square matrix, cf. general_eigenvalues_in_place.
+   * The matrix is copied.
+   *
+   * @param m The matrix, a view or a lazy expression
+   * @return The complex eigenvalues, in the order of lapack (not sorted)
+   */
+  template <ArrayOfRank<2> M>
+  auto general_eigenvalues(M const &m) {
+    return general_eigenvalues_in_place(matrix<get_value_t<M>, F_layout>{m});
+  }
+
+  /**
+   * Eigenvalues and right eigenvectors of a general (non hermitian) square matrix, cf. general_eigenelements_in_place.
+   *
+   * @param m The matrix, a view or a lazy expression
+   * @return Pair of the complex eigenvalues and the matrix of the right eigenvectors as columns
+   */
+  template <ArrayOfRank<2> M>
+  auto general_eigenelements(M const &m) {
+    using T = get_value_t<M>;
+    auto w  = details::eigenvalue_array_t<T>{};
+    auto vr = matrix<std::complex<blas::real_value_t<T>>>{};
+    general_eigenelements_in_place(matrix<T, F_layout>{m}, w, vr);
+    return std::make_pair(std::move(w), std::move(vr));
+  }
+
+  /**
+   * Eigenvalues, left and right eigenvectors of a general (non hermitian) square matrix, cf. general_eigenelements_in_place.
+   *
+   * @param m The matrix, a view or a lazy expression
+   * @return Tuple of the complex eigenvalues, the left and the right eigenvectors as columns
+   */
+  template <ArrayOfRank<2> M>
+  auto general_eigenelements_left_right(M const &m) {
+    using T = get_value_t<M>;
+    auto w  = details::eigenvalue_array_t<T>{};
+    auto vl = matrix<std::complex<blas::real_value_t<T>>>{};
+    auto vr = matrix<std::complex<blas::real_value_t<T>>>{};
+    general_eigenelements_in_place(matrix<T, F_layout>{m}, w, vl, vr);
+    return std::make_tuple(std::move(w), std::move(vl), std::move(vr));
+  }
+
+  //--------------------------------
+  // Generalized hermitian definite problems
+  //--------------------------------
+
+  namespace details {
+
+    // The generalized problem h x = lambda s x, cf. generalized_eigenelements_in_place.
+    // In C order, lapack sees the transposes, i.e. the complex conjugates of h and s :
+    // its eigenvectors are the conjugates of those of the problem, stored as rows.
+    template <typename H, typename S>
+    auto generalized_eigen_impl(H &&h, S &&s, char jobz, lapack::eigen_workspace<get_value_t<H>> &ws) {
+      using T = get_value_t<H>;
+      static_assert(std::is_same_v<get_value_t<S>, T>, "generalized eigenelements : the matrices must have the same element type");
+      static_assert(std::decay_t<H>::is_stride_order_C() == std::decay_t<S>::is_stride_order_C(),
+                    "generalized eigenelements : the matrices must have the same memory order");
+      constexpr bool transposed = std::decay_t<H>::is_stride_order_C();
+      EXPECTS(is_matrix_square(h, true));
+      EXPECTS(h.shape() == s.shape());
+      EXPECTS(h.indexmap().min_stride() == 1 and s.indexmap().min_stride() == 1);
+
+      auto ev  = array<blas::real_value_t<T>, 1>(h.extent(0));
+      int info = 0;
+      if constexpr (transposed)
+        info = lapack::sygvd(transpose(h), transpose(s), ev, jobz, 'L', 1, ws);
+      else
+        info = lapack::sygvd(h, s, ev, jobz, 'U', 1, ws);
+      if (info > h.extent(0))
+        NDA_RUNTIME_ERROR << "Error in generalized eigenelements : the overlap matrix is not positive definite. sygvd info = " << info;
+      if (info != 0) NDA_RUNTIME_ERROR << "Error in generalized eigenelements : the algorithm failed to converge. sygvd info = " << info;
+
+      if (jobz == 'V' and transposed) adjoint_in_place(h);
+      return ev;
+    }
+
+  } // namespace details
+
+  /**
+   * Solve the generalized eigenproblem h x = lambda s x, h being symmetric (hermitian) and s positive definite
+   * (e.g. a Hamiltonian in a non orthogonal basis of overlap s), with lapack sygvd/hegvd.
+   * The problem is reduced to a standard one with the Cholesky factorization of s, without forming s^{-1} h.
+   * Perform the operation in place, avoiding the copy of the matrices. Only their upper triangles are referenced.
+   *
+   * @param h The matrix or view (C or Fortran memory order, with unit smallest stride).
+   *          On return, the eigenvectors as columns, normalized such that X^H s X = 1.
+   * @param s The positive definite matrix or view, with the memory order of h. On return, its Cholesky factor.
+   * @param ws The workspace of lapack, reused from one call to the next : the calls with the same dimension do not allocate it
+   * @return The eigenvalues, in ascending order
+   */
+  template <MemoryArrayOfRank<2> H, MemoryArrayOfRank<2> S>
+  auto generalized_eigenelements_in_place(H &&h, S &&s, lapack::eigen_workspace<get_value_t<H>> &ws) {
+    return details::generalized_eigen_impl(h, s, 'V', ws);
+  }
+
+  /// Solve the generalized eigenproblem h x = lambda s x in place, with a workspace allocated for this call only, cf. above
+  template <MemoryArrayOfRank<2> H, MemoryArrayOfRank<2> S>
+  auto generalized_eigenelements_in_place(H &&h, S &&s) {
+    auto ws = lapack::eigen_workspace<get_value_t<H>>{};
+    return details::generalized_eigen_impl(h, s, 'V', ws);
+  }
+
+  /**
+   * Eigenvalues of the generalized eigenproblem h x = lambda s x, cf. generalized_eigenelements_in_place.
+   * Perform the operation in place, avoiding the copy of the matrices, but invalidating their contents.
+   *
+   * @param h The matrix or view (C or Fortran memory order, with unit smallest stride)
+   * @param s The positive definite matrix or view, with the memory order of h
+   * @param ws The workspace of lapack, reused from one call to the next
+   * @return The eigenvalues, in ascending order
+   */
+  template <MemoryArrayOfRank<2> H, MemoryArrayOfRank<2> S>
+  auto generalized_eigenvalues_in_place(H &&h, S &&s, lapack::eigen_workspace<get_value_t<H>> &ws) {
+    return details::generalized_eigen_impl(h, s, 'N', ws);
+  }
+
+  /// Eigenvalues of the generalized eigenproblem h x = lambda s x in place, with a workspace allocated for this call only, cf. above
+  template <MemoryArrayOfRank<2> H, MemoryArrayOfRank<2> S>
+  auto generalized_eigenvalues_in_place(H &&h, S &&s) {
+    auto ws = lapack::eigen_workspace<get_value_t<H>>{};
+    return details::generalized_eigen_impl(h, s, 'N', ws);
+  }
+
+  /**
+   * Solve the generalized eigenproblem h x = lambda s x, cf. generalized_eigenelements_in_place.
+   * The matrices are copied.
+   *
+   * @param h The symmetric (hermitian) matrix, a view or a lazy expression
+   * @param s The positive definite matrix, a view or a lazy expression
+   * @return Pair of the eigenvalues in ascending order, and the matrix of the eigenvectors as columns, normalized such that X^H s X = 1
+   */
+  template <ArrayOfRank<2> H, ArrayOfRank<2> S>
+  auto generalized_eigenelements(H const &h, S const &s) {
+    using T = get_value_t<H>;
+    auto x  = matrix<T, F_layout>{h};
+    auto ev = generalized_eigenelements_in_place(x, matrix<T, F_layout>{s});
+    return std::make_pair(std::move(ev), std::move(x));
+  }
+
+  /**
+   * Eigenvalues of the generalized eigenproblem h x = lambda s x, cf. generalized_eigenelements_in_place.
+   * The matrices are copied.
+   *
+   * @param h The symmetric (hermitian) matrix, a view or a lazy expression
+   * @param s The positive definite matrix, a view or a lazy expression
+   * @return The eigenvalues, in ascending order
+   */
+  template <ArrayOfRank<2> H, ArrayOfRank<2> S>
+  auto generalized_eigenvalues(H const &h, S const &s) {
+    using T = get_value_t<H>;
+    return generalized_eigenvalues_in_place(matrix<T, F_layout>{h}, matrix<T, F_layout>{s});
+  }
+
 } // namespace nda::linalg
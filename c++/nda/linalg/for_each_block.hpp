@@ -0,0 +1,59 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include <exception>
+#include <vector>
+
+namespace nda::details {
+
+  // Below this number of flops, the blocks are not distributed over threads
+  constexpr long block_parallel_threshold = 1 << 15;
+
+  // Call f(b) for b = 0, ..., n_blocks - 1, distributed over the OpenMP threads when the total work (in flops) is worth it.
+  // An exception thrown by f is rethrown on the calling thread, after all blocks have been processed.
+  template <typename F>
+  void for_each_block(long n_blocks, [[maybe_unused]] long work, F f) {
+    std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (n_blocks > 1 and work > block_parallel_threshold)
+#endif
+    for (long b = 0; b < n_blocks; ++b) {
+      try {
+        f(b);
+      } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(nda_for_each_block)
+#endif
+        if (not error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+  }
+
+  // Call f(b) for each non empty block b of the given sizes, cf. above. The work is the sum of the cubes of the sizes.
+  // The empty blocks are skipped : blas/lapack reject their leading dimension 0.
+  template <typename F>
+  void for_each_block(std::vector<long> const &sizes, F f) {
+    long work = 0;
+    for (auto n : sizes) work += n * n * n;
+    for_each_block(long(sizes.size()), work, [&sizes, &f](long b) {
+      if (sizes[b] > 0) f(b);
+    });
+  }
+
+} // namespace nda::details
@@ -0,0 +1,421 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "../blas/gemm.hpp"
+#include "./eigenelements.hpp"
+#include "./krylov.hpp"
+#include "./randomized_svd.hpp"
+
+namespace nda::linalg {
+
+  /// Parameters of the iterative eigensolvers
+  struct eigensolver_options {
+    /// Convergence : ||A x - theta x|| <= tol * ||A||, ||A|| being estimated by the largest Ritz value in absolute value.
+    /// 0 : a default depending on the precision of the element type, 1e-10 in double and 1e-4 in single precision
+    double tol = 0;
+
+    /// Maximal dimension of the basis. 0 : a default depending on the number of eigenpairs
+    long max_basis = 0;
+
+    /// Maximal number of restarts (lanczos) or of iterations (davidson)
+    long max_iter = 1000;
+
+    /// Seed of the random initial vector (lanczos). If not provided, a random seed is used.
+    std::optional<std::uint64_t> seed = {};
+  };
+
+  /// The lowest eigenpairs computed by an iterative eigensolver
+  template <typename T>
+  struct eigensolver_result {
+    /// The eigenvalues, in ascending order
+    array<blas::real_value_t<T>, 1> eigenvalues;
+
+    /// The eigenvectors, as columns
+    matrix<T, F_layout> eigenvectors;
+
+    /// The residual norms ||A x - theta x|| of the eigenpairs
+    array<double, 1> residuals;
+
+    /// Have all the eigenpairs converged ?
+    bool converged = false;
+
+    /// Number of applications of the operator
+    long n_matvec = 0;
+
+    /// Number of restarts (lanczos) or of iterations (davidson)
+    long n_iter = 0;
+  };
+
+  namespace details {
+
+    // c = alpha * a^H * b + beta * c, for Fortran ordered matrices or views with unit smallest stride.
+    // The adjoint is taken by blas : the (large) matrix a is not copied.
+    template <typename T, typename A, typename B, typename C>
+    void gemm_adjoint(T alpha, A const &a, B const &b, T beta, C &&c) {
+      blas::f77::gemm((is_complex_v<T> ? 'C' : 'T'), 'N', a.extent(1), b.extent(1), a.extent(0), alpha, a.data(), blas::get_ld(a), b.data(),
+                      blas::get_ld(b), beta, c.data(), blas::get_ld(c));
+    }
+
+    // The column j of a Fortran ordered matrix, as a contiguous vector
+    template <typename T>
+    array_view<T, 1> column(matrix<T, F_layout> &v, long j) {
+      return {std::array<long, 1>{v.extent(0)}, v.data() + j * v.indexmap().strides()[1]};
+    }
+
+    // Project the columns k, ..., k + p - 1 of v out of the span of the orthonormal columns k0, ..., k - 1.
+    // Block classical Gram-Schmidt, done twice, with gemm. The coefficients are accumulated in c(range(k0, k), range(0, p)).
+    // c must have at least 2 * p columns.
+    template <typename T, typename C>
+    void project_out(matrix<T, F_layout> &v, long k0, long k, long p, C &&c) {
+      if (k == k0 or p == 0) return;
+      auto vk = v(range::all, range(k0, k));
+      auto w  = v(range::all, range(k, k + p));
+      auto c1 = c(range(k0, k), range(0, p));
+      auto c2 = c(range(k0, k), range(p, 2 * p));
+      gemm_adjoint(T{1}, vk, w, T{0}, c1);
+      blas::gemm(T{-1}, vk, c1, T{1}, w);
+      gemm_adjoint(T{1}, vk, w, T{0}, c2);
+      blas::gemm(T{-1}, vk, c2, T{1}, w);
+      c1 += c2;
+    }
+
+    // Orthonormalize the columns k, ..., k + p - 1 of v against the orthonormal columns 0, ..., k - 1 (gemm) and among themselves.
+    // The columns numerically in the span of the previous ones are dropped, the others are moved to the front.
+    // Returns the number of columns kept.
+    template <typename T, typename C>
+    long orthonormalize_columns(matrix<T, F_layout> &v, long k, long p, C &&c) {
+      auto norm0 = array<double, 1>(p);
+      for (long i = 0; i < p; ++i) norm0(i) = norm2(column(v, k + i));
+      project_out(v, 0, k, p, c);
+
+      long kept = 0;
+      for (long i = 0; i < p; ++i) {
+        long j = k + kept;
+        if (j != k + i) v(range::all, j) = v(range::all, k + i);
+        project_out(v, k, j, 1, c);
+        double nrm = norm2(column(v, j));
+        if (nrm == 0 or nrm <= 1e-8 * norm0(i)) continue;
+        blas::scal(T(1 / nrm), column(v, j));
+        ++kept;
+      }
+      return kept;
+    }
+
+    // The default dimension of the basis for nev eigenpairs of an operator of dimension n
+    inline long default_basis_size(eigensolver_options const &opts, long n, long min_size) {
+      return std::min(n, (opts.max_basis > 0 ? opts.max_basis : std::max(20l, min_size)));
+    }
+
+    // The convergence tolerance for the element type T
+    template <typename T>
+    double tolerance(eigensolver_options const &opts) {
+      if (opts.tol > 0) return opts.tol;
+      return (std::is_same_v<blas::real_value_t<T>, float> ? 1e-4 : 1e-10);
+    }
+
+  } // namespace details
+
+  /**
+   * Thick restart Lanczos (Wu, Simon, SIAM J. Matrix Anal. Appl. 22, 602 (2000)) for the lowest eigenpairs
+   * of a large symmetric (hermitian) operator.
+   *
+   * The operator is applied only through y = A(x) : it can be a dense or a sparse matrix, or a callable
+   * as in cg_solver, applied to contiguous vectors of type array_view<T const, 1> and array_view<T, 1>.
+   *
+   * The Lanczos basis is stored in one Fortran ordered matrix, and fully reorthogonalized at each step with gemm
+   * (classical Gram-Schmidt, twice). When the basis is full, the lowest Ritz vectors are kept, together with
+   * the last Lanczos vector, and the iteration is restarted from them.
+   * The workspace is allocated by the first solve and reused as long as the dimensions do not change.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class lanczos_solver {
+    static_assert(blas::is_blas_lapack_v<T>, "lanczos_solver : element type must be a blas/lapack type");
+
+    eigensolver_options _opts;
+
+    // The Lanczos basis (n x (m + 1)), and the Ritz vectors at a restart (n x m)
+    matrix<T, F_layout> _v, _x;
+
+    // The projected matrix V^H A V (upper triangle), its eigenvectors, and the Gram-Schmidt coefficients
+    matrix<T, F_layout> _h, _y, _c;
+
+    void _resize(long n, long m) {
+      if (_v.extent(0) == n and _h.extent(0) == m) return;
+      _v.resize(n, m + 1);
+      _x.resize(n, m);
+      _h.resize(m, m);
+      _y.resize(m, m);
+      _c.resize(m + 1, 2);
+    }
+
+    public:
+    explicit lanczos_solver(eigensolver_options const &opts = {}) : _opts(opts) {}
+
+    /// The parameters of the solver
+    [[nodiscard]] eigensolver_options const &options() const { return _opts; }
+
+    /**
+     * The lowest eigenpairs of a symmetric (hermitian) operator
+     *
+     * @param a The operator
+     * @param n The dimension of the operator
+     * @param nev The number of eigenpairs
+     */
+    template <typename Op>
+    eigensolver_result<T> solve(Op const &a, long n, long nev) {
+      EXPECTS(nev >= 1 and nev <= n);
+      long m = details::default_basis_size(_opts, n, 2 * nev + 10);
+      EXPECTS_WITH_MESSAGE(m > nev or m == n, "lanczos_solver : the basis must be larger than the number of eigenpairs");
+      _resize(n, m);
+      auto _     = range::all;
+      auto gen   = details::make_generator(_opts.seed);
+      double tol = details::tolerance<T>(_opts);
+
+      // random normalized initial vector
+      _v(_, 0) = details::gaussian_matrix<T>(n, 1, gen)(_, 0);
+      details::orthonormalize_columns(_v, 0, 1, _c);
+      _h = 0;
+
+      auto res    = eigensolver_result<T>{};
+      long j      = 0;
+      double beta = 0;
+      for (long restart = 0;; ++restart) {
+
+        // Lanczos steps, with full reorthogonalization : A v_j = sum_i h_ij v_i + beta v_{j+1}
+        for (; j < m; ++j) {
+          details::apply_operator(a, array_view<T const, 1>{details::column(_v, j)}, details::column(_v, j + 1));
+          ++res.n_matvec;
+          double norm0 = details::norm2(details::column(_v, j + 1));
+          details::project_out(_v, 0, j + 1, 1, _c);
+          _h(range(0, j + 1), j) = _c(range(0, j + 1), 0);
+          beta                   = details::norm2(details::column(_v, j + 1));
+          if (beta > 1e-12 * norm0) {
+            blas::scal(T(1 / beta), details::column(_v, j + 1));
+          } else {
+            // Invariant subspace : continue with a new random vector, orthogonal to the basis
+            beta = 0;
+            if (j + 1 < n) {
+              _v(_, j + 1) = details::gaussian_matrix<T>(n, 1, gen)(_, 0);
+              details::orthonormalize_columns(_v, j + 1, 1, _c);
+            }
+          }
+        }
+
+        // Rayleigh-Ritz : the residual of the Ritz pair (theta_i, V y_i) is beta * |y_i(m - 1)|
+        _y          = _h;
+        auto theta  = eigenelements_in_place(_y);
+        double anrm = std::max(std::abs(theta(0)), std::abs(theta(m - 1)));
+        res.residuals.resize(nev);
+        for (long i = 0; i < nev; ++i) res.residuals(i) = beta * std::abs(_y(m - 1, i));
+        res.converged = std::all_of(res.residuals.begin(), res.residuals.end(), [&](double r) { return r <= tol * anrm; });
+        res.n_iter    = restart;
+
+        if (res.converged or restart >= _opts.max_iter) {
+          res.eigenvalues = theta(range(0, nev));
+          res.eigenvectors.resize(n, nev);
+          blas::gemm(T{1}, _v(_, range(0, m)), _y(_, range(0, nev)), T{0}, res.eigenvectors);
+          return res;
+        }
+
+        // Thick restart : keep the p lowest Ritz vectors and the last Lanczos vector.
+        // The projected matrix is diagonal on the Ritz vectors, the coupling to the last vector is computed by the next step.
+        long p  = std::min(m - 1, nev + (m - nev) / 2);
+        auto xp = _x(_, range(0, p));
+        blas::gemm(T{1}, _v(_, range(0, m)), _y(_, range(0, p)), T{0}, xp);
+        _v(_, range(0, p)) = xp;
+        _v(_, p)           = _v(_, m);
+        _h                 = 0;
+        for (long i = 0; i < p; ++i) _h(i, i) = theta(i);
+        j = p;
+      }
+    }
+  };
+
+  /**
+   * Block Davidson (Davidson, J. Comput. Phys. 17, 87 (1975)) for the lowest eigenpairs of a large
+   * symmetric (hermitian) operator with a dominant diagonal, e.g. a Hamiltonian in a basis of many body states.
+   *
+   * The operator is given as in lanczos_solver, together with its diagonal.
+   * At each iteration, the residuals r of the unconverged Ritz pairs are preconditioned with the diagonal,
+   * t = (D - theta)^{-1} r, and the corrections are added to the basis after a block orthogonalization with gemm.
+   * The basis and its image by the operator are stored in two Fortran ordered matrices.
+   * When the basis is full, it is collapsed onto the m / 2 lowest Ritz vectors (at least nev).
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class davidson_solver {
+    static_assert(blas::is_blas_lapack_v<T>, "davidson_solver : element type must be a blas/lapack type");
+
+    eigensolver_options _opts;
+
+    // The basis V and A V (n x m), the Ritz vectors X and A X (n x q, q >= nev Ritz vectors being kept when the basis is collapsed)
+    matrix<T, F_layout> _v, _av, _x, _ax;
+
+    // The projected matrix V^H A V (upper triangle), its eigenvectors, and the Gram-Schmidt coefficients
+    matrix<T, F_layout> _h, _y, _c;
+
+    void _resize(long n, long m, long nev, long q) {
+      if (_v.extent(0) == n and _h.extent(0) == m and _x.extent(1) == q and _c.extent(1) == 2 * nev) return;
+      _v.resize(n, m);
+      _av.resize(n, m);
+      _x.resize(n, q);
+      _ax.resize(n, q);
+      _h.resize(m, m);
+      _y.resize(m, m);
+      _c.resize(m, 2 * nev);
+    }
+
+    public:
+    explicit davidson_solver(eigensolver_options const &opts = {}) : _opts(opts) {}
+
+    /// The parameters of the solver
+    [[nodiscard]] eigensolver_options const &options() const { return _opts; }
+
+    /**
+     * The lowest eigenpairs of a symmetric (hermitian) operator
+     *
+     * @param a The operator
+     * @param diag The diagonal of the operator (real), which also gives its dimension
+     * @param nev The number of eigenpairs
+     */
+    template <typename Op, ArrayOfRank<1> D>
+    eigensolver_result<T> solve(Op const &a, D const &diag, long nev) {
+      long n = diag.extent(0);
+      EXPECTS(nev >= 1 and nev <= n);
+      long m = details::default_basis_size(_opts, n, 4 * nev);
+      EXPECTS_WITH_MESSAGE(m >= 2 * nev or m == n, "davidson_solver : the basis must be at least twice as large as the number of eigenpairs");
+      long q = std::max(nev, m / 2);
+      _resize(n, m, nev, q);
+      auto _     = range::all;
+      double tol = details::tolerance<T>(_opts);
+
+      // The initial vectors are the unit vectors of the nev lowest diagonal elements
+      auto idx = std::vector<long>(n);
+      std::iota(idx.begin(), idx.end(), 0);
+      std::partial_sort(idx.begin(), idx.begin() + nev, idx.end(), [&diag](long i, long j) { return std::real(diag(i)) < std::real(diag(j)); });
+      _v(_, range(0, nev)) = 0;
+      for (long i = 0; i < nev; ++i) _v(idx[i], i) = 1;
+      _h = 0;
+
+      auto res   = eigensolver_result<T>{};
+      long k_old = 0, k = nev;
+      for (long it = 0;; ++it) {
+
+        // A V and the projected matrix, for the new columns of the basis
+        for (long i = k_old; i < k; ++i) details::apply_operator(a, array_view<T const, 1>{details::column(_v, i)}, details::column(_av, i));
+        res.n_matvec += k - k_old;
+        auto hk = _h(range(0, k), range(0, k));
+        details::gemm_adjoint(T{1}, _v(_, range(0, k)), _av(_, range(k_old, k)), T{0}, _h(range(0, k), range(k_old, k)));
+
+        // Rayleigh-Ritz : X = V y, A X = A V y
+        auto yk = _y(range(0, k), range(0, k));
+        yk      = hk;
+        auto theta = eigenelements_in_place(yk);
+        auto x     = _x(_, range(0, nev));
+        auto ax    = _ax(_, range(0, nev));
+        blas::gemm(T{1}, _v(_, range(0, k)), yk(_, range(0, nev)), T{0}, x);
+        blas::gemm(T{1}, _av(_, range(0, k)), yk(_, range(0, nev)), T{0}, ax);
+
+        // Residuals ||A x - theta x||
+        double anrm = std::max(std::abs(theta(0)), std::abs(theta(k - 1)));
+        res.residuals.resize(nev);
+        auto unconverged = std::vector<long>{};
+        for (long i = 0; i < nev; ++i) {
+          double r2 = 0;
+          for (long l = 0; l < n; ++l) r2 += std::norm(ax(l, i) - theta(i) * x(l, i));
+          res.residuals(i) = std::sqrt(r2);
+          if (!(res.residuals(i) <= tol * anrm)) unconverged.push_back(i); // a NaN residual has not converged
+        }
+        res.converged = unconverged.empty();
+        res.n_iter    = it;
+
+        auto finish = [&]() {
+          res.eigenvalues  = theta(range(0, nev));
+          res.eigenvectors = x;
+          return res;
+        };
+        if (res.converged or it >= _opts.max_iter) return finish();
+
+        // No room left for the corrections : collapse the basis onto the lowest Ritz vectors (thick restart)
+        if (k + long(unconverged.size()) > m) {
+          long qk = std::min(q, k);
+          auto xq = _x(_, range(0, qk)), axq = _ax(_, range(0, qk));
+          blas::gemm(T{1}, _v(_, range(0, k)), yk(_, range(0, qk)), T{0}, xq);
+          blas::gemm(T{1}, _av(_, range(0, k)), yk(_, range(0, qk)), T{0}, axq);
+          _v(_, range(0, qk))  = xq;
+          _av(_, range(0, qk)) = axq;
+          _h                   = 0;
+          for (long i = 0; i < qk; ++i) _h(i, i) = theta(i);
+          k = qk;
+        }
+
+        // The corrections t = (D - theta)^{-1} (A x - theta x), appended to the basis
+        long p = std::min(long(unconverged.size()), m - k);
+        for (long s = 0; s < p; ++s) {
+          long i = unconverged[s];
+          auto t = details::column(_v, k + s);
+          for (long l = 0; l < n; ++l) {
+            blas::real_value_t<T> d = std::real(diag(l)) - theta(i);
+            if (std::abs(d) < 1e-8) d = 1e-8;
+            t(l) = (ax(l, i) - theta(i) * x(l, i)) / d;
+          }
+        }
+        k_old = k;
+        k += details::orthonormalize_columns(_v, k, p, _c);
+        if (k == k_old) return finish(); // the corrections are all in the span of the basis : no progress is possible
+      }
+    }
+  };
+
+  /**
+   * The lowest eigenpairs of a symmetric (hermitian) operator with the thick restart Lanczos, cf. lanczos_solver.
+   *
+   * @param a The operator
+   * @param n Its dimension
+   * @param nev The number of eigenpairs
+   * @param opts The parameters of the solver
+   */
+  template <typename T, typename Op>
+  eigensolver_result<T> lanczos(Op const &a, long n, long nev, eigensolver_options const &opts = {}) {
+    return lanczos_solver<T>{opts}.solve(a, n, nev);
+  }
+
+  /**
+   * The lowest eigenpairs of a symmetric (hermitian) operator with the block Davidson, cf. davidson_solver.
+   *
+   * @param a The operator
+   * @param diag Its diagonal
+   * @param nev The number of eigenpairs
+   * @param opts The parameters of the solver
+   */
+  template <typename T, typename Op, ArrayOfRank<1> D>
+  eigensolver_result<T> davidson(Op const &a, D const &diag, long nev, eigensolver_options const &opts = {}) {
+    return davidson_solver<T>{opts}.solve(a, diag, nev);
+  }
+
+} // namespace nda::linalg
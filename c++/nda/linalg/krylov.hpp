@@ -0,0 +1,497 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include "../blas/axpy.hpp"
+#include "../blas/dot.hpp"
+#include "../blas/scal.hpp"
+#include "./matmul.hpp"
+
+namespace nda::linalg {
+
+  /// Stopping criteria of the Krylov solvers
+  struct krylov_options {
+    /// Relative tolerance : the iteration stops when ||b - A x|| <= max(rtol * ||b||, atol)
+    double rtol = 1e-10;
+
+    /// Absolute tolerance
+    double atol = 0;
+
+    /// Maximal number of iterations
+    long max_iter = 1000;
+
+    /// Dimension of the Krylov subspace after which gmres restarts
+    long restart = 30;
+  };
+
+  /// Outcome of a Krylov solve
+  struct krylov_result {
+    /// Has the tolerance been reached ?
+    bool converged = false;
+
+    /// Number of iterations performed
+    long n_iter = 0;
+
+    /// The relative residual ||b - A x|| / ||b||, as estimated by the iteration
+    double residual = 0;
+  };
+
+  /// The trivial preconditioner z = r
+  struct identity_preconditioner {};
+
+  namespace details {
+
+    // y = a(x) for
+    //   * a dense matrix, through matvecmul_into,
+    //   * a callable a(x, y) writing into y,
+    //   * a callable returning a(x),
+    //   * any other operator with a matvecmul_into overload (e.g. a sparse matrix).
+    template <typename Op, typename X, typename Y>
+    void apply_operator(Op const &a, X const &x, Y &&y) {
+      if constexpr (std::is_same_v<Op, identity_preconditioner>)
+        y = x;
+      else if constexpr (Array<Op>)
+        matvecmul_into(y, a, x);
+      else if constexpr (std::is_invocable_v<Op const &, X const &, Y>)
+        a(x, y);
+      else if constexpr (std::is_invocable_v<Op const &, X const &>)
+        y = a(x);
+      else
+        matvecmul_into(y, a, x);
+    }
+
+    // Euclidean norm of a vector
+    template <typename V>
+    double norm2(V const &v) {
+      return std::sqrt(std::real(blas::dotc(v, v)));
+    }
+
+    // Solve the systems a * x(_, k) = b(_, k) one after the other, with the workspace of the solver
+    template <typename Solver, typename Op, typename B, typename X, typename M>
+    std::vector<krylov_result> solve_columns(Solver &solver, Op const &a, B const &b, X &&x, M const &m) {
+      EXPECTS(b.shape() == x.shape());
+      auto results = std::vector<krylov_result>(b.extent(1));
+      for (long k = 0; k < b.extent(1); ++k) results[k] = solver.solve(a, b(range::all, k), x(range::all, k), m);
+      return results;
+    }
+
+  } // namespace details
+
+  /**
+   * Preconditioned conjugate gradient, for a symmetric (hermitian) positive definite operator.
+   *
+   * The operator A and the preconditioner M (approximating A^{-1}, also symmetric positive definite) can be
+   * dense matrices, sparse matrices or any callable, either y = A(x) or A(x, y) writing into y.
+   * They are applied to contiguous vectors of the workspace, of type array_view<T const, 1> and array_view<T, 1>.
+   *
+   * The workspace vectors are allocated by the first solve, and reused as long as the dimension does not change :
+   * the iterations do not allocate.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class cg_solver {
+    static_assert(blas::is_blas_lapack_v<T>, "cg_solver : element type must be a blas/lapack type");
+
+    krylov_options _opts;
+
+    // residual, preconditioned residual, search direction, A * search direction
+    array<T, 1> _r, _z, _p, _q;
+
+    void _resize(long n) {
+      if (_r.size() == n) return;
+      for (auto *v : {&_r, &_z, &_p, &_q}) v->resize(n);
+    }
+
+    template <typename Op>
+    void _apply(Op const &a, array<T, 1> const &x, array<T, 1> &y) const {
+      details::apply_operator(a, array_view<T const, 1>{x}, array_view<T, 1>{y});
+    }
+
+    public:
+    explicit cg_solver(krylov_options const &opts = {}) : _opts(opts) {}
+
+    /// The stopping criteria
+    [[nodiscard]] krylov_options const &options() const { return _opts; }
+
+    /**
+     * Solve A * x = b
+     *
+     * @param a The operator
+     * @param b The right hand side
+     * @param x On input the initial guess, on output the solution. Can be a strided view.
+     * @param m The preconditioner
+     */
+    template <typename Op, ArrayOfRank<1> B, blas::VectorView X, typename M = identity_preconditioner>
+    krylov_result solve(Op const &a, B const &b, X &&x, M const &m = {}) {
+      static_assert(std::is_same_v<get_value_t<X>, T>, "cg_solver : the solution must have the element type of the solver");
+      long n = b.extent(0);
+      EXPECTS(x.extent(0) == n);
+      _resize(n);
+      if (n == 0) return {true, 0, 0};
+
+      _r           = b;
+      double bnorm = details::norm2(_r);
+      if (bnorm == 0) {
+        x = 0;
+        return {true, 0, 0};
+      }
+      double tol = std::max(_opts.rtol * bnorm, _opts.atol);
+
+      // r = b - A * x, p = z = M * r
+      _z = x;
+      _apply(a, _z, _q);
+      blas::axpy(T{-1}, _q, _r);
+      double rnorm = details::norm2(_r);
+      _apply(m, _r, _z);
+      _p        = _z;
+      double rz = std::real(blas::dotc(_r, _z));
+
+      long it = 0;
+      while (rnorm > tol and it < _opts.max_iter) {
+        _apply(a, _p, _q);
+        double pq = std::real(blas::dotc(_p, _q));
+        if (pq <= 0) break; // the operator is not positive definite
+        T alpha = rz / pq;
+        blas::axpy(alpha, _p, x);
+        blas::axpy(-alpha, _q, _r);
+        rnorm = details::norm2(_r);
+        ++it;
+        if (rnorm <= tol) break;
+
+        // p = z + beta * p
+        _apply(m, _r, _z);
+        double rz_new = std::real(blas::dotc(_r, _z));
+        blas::scal(T(rz_new / rz), _p);
+        blas::axpy(T{1}, _z, _p);
+        rz = rz_new;
+      }
+      return {rnorm <= tol, it, rnorm / bnorm};
+    }
+
+    /// Solve A * x(_, k) = b(_, k) for each column k, reusing the workspace
+    template <typename Op, ArrayOfRank<2> B, blas::MatrixView X, typename M = identity_preconditioner>
+    std::vector<krylov_result> solve(Op const &a, B const &b, X &&x, M const &m = {}) {
+      return details::solve_columns(*this, a, b, x, m);
+    }
+  };
+
+  /**
+   * Preconditioned BiCGStab, for a general (non hermitian) operator.
+   *
+   * The operator and the preconditioner (right preconditioning) are given as in cg_solver.
+   * Each iteration applies the operator and the preconditioner twice. The iterations do not allocate.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class bicgstab_solver {
+    static_assert(blas::is_blas_lapack_v<T>, "bicgstab_solver : element type must be a blas/lapack type");
+
+    krylov_options _opts;
+
+    // residual, shadow residual, search direction, A * M * p, M * p, M * s, A * M * s
+    array<T, 1> _r, _r0, _p, _v, _phat, _shat, _t;
+
+    void _resize(long n) {
+      if (_r.size() == n) return;
+      for (auto *v : {&_r, &_r0, &_p, &_v, &_phat, &_shat, &_t}) v->resize(n);
+    }
+
+    template <typename Op>
+    void _apply(Op const &a, array<T, 1> const &x, array<T, 1> &y) const {
+      details::apply_operator(a, array_view<T const, 1>{x}, array_view<T, 1>{y});
+    }
+
+    public:
+    explicit bicgstab_solver(krylov_options const &opts = {}) : _opts(opts) {}
+
+    /// The stopping criteria
+    [[nodiscard]] krylov_options const &options() const { return _opts; }
+
+    /**
+     * Solve A * x = b
+     *
+     * @param a The operator
+     * @param b The right hand side
+     * @param x On input the initial guess, on output the solution. Can be a strided view.
+     * @param m The preconditioner
+     */
+    template <typename Op, ArrayOfRank<1> B, blas::VectorView X, typename M = identity_preconditioner>
+    krylov_result solve(Op const &a, B const &b, X &&x, M const &m = {}) {
+      static_assert(std::is_same_v<get_value_t<X>, T>, "bicgstab_solver : the solution must have the element type of the solver");
+      long n = b.extent(0);
+      EXPECTS(x.extent(0) == n);
+      _resize(n);
+      if (n == 0) return {true, 0, 0};
+
+      _r           = b;
+      double bnorm = details::norm2(_r);
+      if (bnorm == 0) {
+        x = 0;
+        return {true, 0, 0};
+      }
+      double tol = std::max(_opts.rtol * bnorm, _opts.atol);
+
+      // r = b - A * x
+      _phat = x;
+      _apply(a, _phat, _v);
+      blas::axpy(T{-1}, _v, _r);
+      double rnorm = details::norm2(_r);
+
+      _r0   = _r;
+      _p    = 0;
+      _v    = 0;
+      T rho = 1, alpha = 1, omega = 1;
+
+      long it = 0;
+      while (rnorm > tol and it < _opts.max_iter) {
+        T rho_new = blas::dotc(_r0, _r);
+        if (rho_new == T{0}) break; // breakdown
+
+        // p = r + beta * (p - omega * v)
+        T beta = (rho_new / rho) * (alpha / omega);
+        blas::axpy(-omega, _v, _p);
+        blas::scal(beta, _p);
+        blas::axpy(T{1}, _r, _p);
+
+        _apply(m, _p, _phat);
+        _apply(a, _phat, _v);
+        T r0v = blas::dotc(_r0, _v);
+        if (r0v == T{0}) break; // breakdown
+        alpha = rho_new / r0v;
+
+        // s = r - alpha * v, stored in r
+        blas::axpy(-alpha, _v, _r);
+        blas::axpy(alpha, _phat, x);
+        rnorm = details::norm2(_r);
+        ++it;
+        if (rnorm <= tol) break;
+
+        _apply(m, _r, _shat);
+        _apply(a, _shat, _t);
+        blas::real_value_t<T> tt = std::real(blas::dotc(_t, _t));
+        if (tt == 0) break; // breakdown
+        omega = blas::dotc(_t, _r) / tt;
+
+        // r = s - omega * t
+        blas::axpy(omega, _shat, x);
+        blas::axpy(-omega, _t, _r);
+        rnorm = details::norm2(_r);
+        rho   = rho_new;
+        if (omega == T{0}) break; // breakdown
+      }
+      return {rnorm <= tol, it, rnorm / bnorm};
+    }
+
+    /// Solve A * x(_, k) = b(_, k) for each column k, reusing the workspace
+    template <typename Op, ArrayOfRank<2> B, blas::MatrixView X, typename M = identity_preconditioner>
+    std::vector<krylov_result> solve(Op const &a, B const &b, X &&x, M const &m = {}) {
+      return details::solve_columns(*this, a, b, x, m);
+    }
+  };
+
+  /**
+   * Restarted GMRES(m) with right preconditioning, for a general (non hermitian) operator.
+   *
+   * The operator and the preconditioner are given as in cg_solver.
+   * The Krylov basis (of dimension options().restart) is orthogonalized with modified Gram-Schmidt, and the small least square
+   * problem is updated with Givens rotations. The iterations do not allocate.
+   * The residual is recomputed from the solution at each restart, so that convergence is checked on the true residual.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class gmres_solver {
+    static_assert(blas::is_blas_lapack_v<T>, "gmres_solver : element type must be a blas/lapack type");
+
+    krylov_options _opts;
+
+    // The Krylov basis
+    std::vector<array<T, 1>> _basis;
+
+    // The Hessenberg matrix, reduced to triangular form by the rotations
+    matrix<T> _h;
+
+    // The Givens rotations and the rotated rhs of the least square problem
+    array<blas::real_value_t<T>, 1> _cs;
+    array<T, 1> _sn, _g;
+
+    // work vectors
+    array<T, 1> _w, _z;
+
+    void _resize(long n, long m) {
+      if (_w.size() == n and long(_basis.size()) == m + 1) return;
+      _basis.resize(m + 1);
+      for (auto &v : _basis) v.resize(n);
+      _h.resize(m + 1, m);
+      _cs.resize(m);
+      _sn.resize(m);
+      _g.resize(m + 1);
+      _w.resize(n);
+      _z.resize(n);
+    }
+
+    template <typename Op>
+    void _apply(Op const &a, array<T, 1> const &x, array<T, 1> &y) const {
+      details::apply_operator(a, array_view<T const, 1>{x}, array_view<T, 1>{y});
+    }
+
+    // Apply the rotation i to (x, y)
+    void _rotate(long i, T &x, T &y) const {
+      T t = _cs(i) * x + _sn(i) * y;
+      y   = -conj(_sn(i)) * x + _cs(i) * y;
+      x   = t;
+    }
+
+    // The rotation i eliminating y from (x, y)
+    void _make_rotation(long i, T x, T y) {
+      blas::real_value_t<T> ax = std::abs(x);
+      if (ax == 0) {
+        _cs(i) = 0;
+        _sn(i) = 1;
+        return;
+      }
+      blas::real_value_t<T> d = std::hypot(ax, std::abs(y));
+      _cs(i)                  = ax / d;
+      _sn(i)                  = (x / ax) * conj(y) / d;
+    }
+
+    public:
+    explicit gmres_solver(krylov_options const &opts = {}) : _opts(opts) { EXPECTS(_opts.restart > 0); }
+
+    /// The stopping criteria
+    [[nodiscard]] krylov_options const &options() const { return _opts; }
+
+    /**
+     * Solve A * x = b
+     *
+     * @param a The operator
+     * @param b The right hand side
+     * @param x On input the initial guess, on output the solution. Can be a strided view.
+     * @param m The preconditioner
+     */
+    template <typename Op, ArrayOfRank<1> B, blas::VectorView X, typename M = identity_preconditioner>
+    krylov_result solve(Op const &a, B const &b, X &&x, M const &m = {}) {
+      static_assert(std::is_same_v<get_value_t<X>, T>, "gmres_solver : the solution must have the element type of the solver");
+      long n = b.extent(0);
+      EXPECTS(x.extent(0) == n);
+      long mr = std::min(_opts.restart, n);
+      _resize(n, mr);
+      if (n == 0) return {true, 0, 0};
+
+      _basis[0]    = b;
+      double bnorm = details::norm2(_basis[0]);
+      if (bnorm == 0) {
+        x = 0;
+        return {true, 0, 0};
+      }
+      double tol = std::max(_opts.rtol * bnorm, _opts.atol);
+
+      long it      = 0;
+      double rnorm = 0;
+      while (true) {
+        // r = b - A * x, the first vector of the basis
+        _z = x;
+        _apply(a, _z, _w);
+        _basis[0] = b;
+        blas::axpy(T{-1}, _w, _basis[0]);
+        rnorm = details::norm2(_basis[0]);
+        if (rnorm <= tol or it >= _opts.max_iter) break;
+        blas::scal(T(1 / rnorm), _basis[0]);
+        _g    = 0;
+        _g(0) = rnorm;
+
+        long k = 0;
+        while (k < mr and it < _opts.max_iter) {
+          // Arnoldi step : w = A * M * v_k, orthogonalized against the basis
+          _apply(m, _basis[k], _z);
+          _apply(a, _z, _w);
+          for (long i = 0; i <= k; ++i) {
+            _h(i, k) = blas::dotc(_basis[i], _w);
+            blas::axpy(-_h(i, k), _basis[i], _w);
+          }
+          double hn    = details::norm2(_w);
+          _h(k + 1, k) = hn;
+          if (hn != 0) {
+            _basis[k + 1] = _w;
+            blas::scal(T(1 / hn), _basis[k + 1]);
+          }
+
+          // Reduce the new column of h to triangular form, and rotate the rhs accordingly
+          for (long i = 0; i < k; ++i) _rotate(i, _h(i, k), _h(i + 1, k));
+          _make_rotation(k, _h(k, k), _h(k + 1, k));
+          _rotate(k, _h(k, k), _h(k + 1, k));
+          _rotate(k, _g(k), _g(k + 1));
+
+          ++k;
+          ++it;
+          rnorm = std::abs(_g(k));
+          if (rnorm <= tol or hn == 0) break;
+        }
+
+        // Solve the triangular system h * y = g, in place in g, and update x += M * sum_i y_i v_i
+        for (long i = k - 1; i >= 0; --i) {
+          for (long j = i + 1; j < k; ++j) _g(i) -= _h(i, j) * _g(j);
+          _g(i) /= _h(i, i);
+        }
+        _w = 0;
+        for (long i = 0; i < k; ++i) blas::axpy(_g(i), _basis[i], _w);
+        _apply(m, _w, _z);
+        blas::axpy(T{1}, _z, x);
+      }
+      return {rnorm <= tol, it, rnorm / bnorm};
+    }
+
+    /// Solve A * x(_, k) = b(_, k) for each column k, reusing the workspace
+    template <typename Op, ArrayOfRank<2> B, blas::MatrixView X, typename M = identity_preconditioner>
+    std::vector<krylov_result> solve(Op const &a, B const &b, X &&x, M const &m = {}) {
+      return details::solve_columns(*this, a, b, x, m);
+    }
+  };
+
+  /**
+   * Solve A * x = b with the preconditioned conjugate gradient, cf. cg_solver.
+   * For repeated solves, use a cg_solver to reuse its workspace.
+   *
+   * @param a The symmetric (hermitian) positive definite operator
+   * @param b The right hand side : a vector, or a matrix with one right hand side per column
+   * @param x On input the initial guess, on output the solution, with the shape of b
+   * @param opts The stopping criteria
+   * @param m The preconditioner
+   */
+  template <typename Op, Array B, MemoryArray X, typename M = identity_preconditioner>
+  auto cg(Op const &a, B const &b, X &&x, krylov_options const &opts = {}, M const &m = {}) {
+    return cg_solver<get_value_t<X>>{opts}.solve(a, b, x, m);
+  }
+
+  /// Solve A * x = b with the preconditioned BiCGStab, cf. bicgstab_solver and cg
+  template <typename Op, Array B, MemoryArray X, typename M = identity_preconditioner>
+  auto bicgstab(Op const &a, B const &b, X &&x, krylov_options const &opts = {}, M const &m = {}) {
+    return bicgstab_solver<get_value_t<X>>{opts}.solve(a, b, x, m);
+  }
+
+  /// Solve A * x = b with the restarted, preconditioned GMRES, cf. gmres_solver and cg
+  template <typename Op, Array B, MemoryArray X, typename M = identity_preconditioner>
+  auto gmres(Op const &a, B const &b, X &&x, krylov_options const &opts = {}, M const &m = {}) {
+    return gmres_solver<get_value_t<X>>{opts}.solve(a, b, x, m);
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,182 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include "../lapack.hpp"
+#include "./det_and_inverse.hpp"
+#include "./rhs_dispatch.hpp"
+
+namespace nda::linalg {
+
+  /**
+   * LU factorization A = P * L * U of a square matrix, computed once with lapack getrf.
+   *
+   * The factors are kept together with the pivots, so that A * X = B can be solved
+   * repeatedly with getrs, and the determinant and the condition number estimate
+   * are obtained from the factors without refactorizing.
+   *
+   * @tparam T Element type (float, double or their complex counterparts)
+   * @tparam Layout Memory layout of the factors.
+   *         In C order, lapack factorizes the transpose of A, and the solve is done with the transposed factors.
+   */
+  template <typename T, typename Layout = F_layout>
+  class lu_factorization {
+    static_assert(blas::is_blas_lapack_v<T>, "lu_factorization: element type must be a blas/lapack type");
+
+    using matrix_t = matrix<T, Layout>;
+    using real_t   = blas::real_value_t<T>;
+
+    // In C order, lapack sees the transpose of the matrix
+    static constexpr bool transposed = matrix_t::is_stride_order_C();
+
+    // The L and U factors, as returned by getrf
+    matrix_t _lu;
+
+    // The pivot indices (1-based, as in lapack)
+    array<int, 1> _ipiv;
+
+    // The 1-norm of the factorized matrix, needed by gecon
+    real_t _anorm = 0;
+
+    // The info returned by getrf
+    int _info = 0;
+
+    void _factorize() {
+      EXPECTS(is_matrix_square(_lu, true));
+      int n = _lu.extent(0);
+      _ipiv.resize(n);
+      _info = 0;
+      if (n == 0) return;
+
+      // 1-norm of A, i.e. the infinity norm of the transpose seen by lapack in C order
+      array<real_t, 1> work(transposed ? n : 0);
+      _anorm = lapack::f77::lange((transposed ? 'I' : '1'), n, n, _lu.data(), blas::get_ld(_lu), work.data());
+
+      lapack::f77::getrf(n, n, _lu.data(), blas::get_ld(_lu), _ipiv.data(), _info);
+      if (_info < 0) NDA_RUNTIME_ERROR << "Error in lu_factorization : getrf info = " << _info;
+    }
+
+    public:
+    /// Factorize a copy of the matrix a
+    template <ArrayOfRank<2> A>
+    explicit lu_factorization(A const &a) : _lu(a) {
+      _factorize();
+    }
+
+    /// Factorize the matrix a in place, taking ownership of its storage (no copy)
+    explicit lu_factorization(matrix_t &&a) : _lu(std::move(a)) { _factorize(); }
+
+    /// Factorize a new matrix, reusing the storage of the previous factorization if the size is unchanged
+    template <ArrayOfRank<2> A>
+    void factorize(A const &a) {
+      _lu = a;
+      _factorize();
+    }
+
+    /// Dimension of the factorized matrix
+    [[nodiscard]] int size() const { return _lu.extent(0); }
+
+    /// The L and U factors, as computed by getrf (transposed in C order)
+    [[nodiscard]] matrix_t const &lu() const { return _lu; }
+
+    /// The pivot indices, as computed by getrf
+    [[nodiscard]] array<int, 1> const &ipiv() const { return _ipiv; }
+
+    /// The info returned by getrf. A positive value indicates an exactly singular matrix.
+    [[nodiscard]] int info() const { return _info; }
+
+    /// Is the factorized matrix exactly singular ?
+    [[nodiscard]] bool is_singular() const { return _info > 0; }
+
+    /// The determinant of the matrix, from the diagonal of U and the pivots
+    [[nodiscard]] T determinant() const {
+      auto det    = T{1};
+      int n_flips = 0;
+      for (int i = 0; i < size(); i++) {
+        det *= _lu(i, i);
+        // Count the number of row interchanges performed by getrf
+        if (_ipiv(i) != i + 1) ++n_flips;
+      }
+      return ((n_flips % 2 == 1) ? -det : det);
+    }
+
+    /**
+     * Estimate of the reciprocal condition number of the matrix in the 1-norm, using gecon.
+     * The estimate is computed from the factors in O(N^2).
+     */
+    [[nodiscard]] double rcond() const {
+      if (size() == 0) return 1.0;
+      if (is_singular()) return 0.0;
+      int n        = size();
+      real_t rcond = 0;
+      int info     = 0;
+      if constexpr (is_complex_v<T>) {
+        array<T, 1> work(2 * n);
+        array<real_t, 1> rwork(2 * n);
+        lapack::f77::gecon((transposed ? 'I' : '1'), n, _lu.data(), blas::get_ld(_lu), _anorm, rcond, work.data(), rwork.data(), info);
+      } else {
+        array<T, 1> work(4 * n);
+        array<int, 1> iwork(n);
+        lapack::f77::gecon((transposed ? 'I' : '1'), n, _lu.data(), blas::get_ld(_lu), _anorm, rcond, work.data(), iwork.data(), info);
+      }
+      if (info != 0) NDA_RUNTIME_ERROR << "Error in lu_factorization : gecon info = " << info;
+      return rcond;
+    }
+
+    /**
+     * Solve A * X = B in place, B being overwritten by X.
+     *
+     * @param b A vector (one right hand side), a matrix (one right hand side per column)
+     *          or a rank 3 array of shape (n_batch, N, NRHS), each b(i, _, _) being solved.
+     *          Operands which are not lapack compatible are solved through a Fortran ordered copy.
+     */
+    template <MemoryArray B>
+    void solve_in_place(B &&b) const {
+      static_assert(std::is_same_v<get_value_t<B>, T>, "lu_factorization : the right hand side must have the same element type as the matrix");
+      if (is_singular()) NDA_RUNTIME_ERROR << "Error in lu_factorization : matrix is singular. getrf info = " << _info;
+
+      details::rhs_dispatch(b, size(), [this](T *b_ptr, int nrhs, int ldb) {
+        int info = 0;
+        lapack::f77::getrs((transposed ? 'T' : 'N'), size(), nrhs, _lu.data(), blas::get_ld(_lu), _ipiv.data(), b_ptr, ldb, info);
+        if (info != 0) NDA_RUNTIME_ERROR << "Error in lu_factorization : getrs info = " << info;
+      });
+    }
+
+    /**
+     * Solve A * X = B
+     *
+     * @param b A vector, a matrix or a rank 3 array (batch of matrices), cf. solve_in_place
+     * @return The solution X, with the shape of b
+     */
+    template <Array B>
+    auto solve(B const &b) const {
+      // For matrices, use Fortran order directly to avoid a copy in and out of lapack
+      auto x = basic_array<get_value_t<B>, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+      solve_in_place(x);
+      return x;
+    }
+  };
+
+  /// Deduction guide : factorize a copy of any matrix or rank 2 array in Fortran order
+  template <ArrayOfRank<2> A>
+  lu_factorization(A const &) -> lu_factorization<get_value_t<A>>;
+
+  /// Deduction guide : factorize a regular matrix in place
+  template <typename T, typename Layout>
+  lu_factorization(matrix<T, Layout> &&) -> lu_factorization<T, Layout>;
+
+} // namespace nda::linalg
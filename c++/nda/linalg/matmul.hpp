@@ -17,9 +17,92 @@
 #pragma once
 #include "../blas/gemm.hpp"
 #include "../blas/gemv.hpp"
+#include "../blas/syrk.hpp"
 
 namespace nda {
 
+  namespace details {
+
+    // Can a be passed to blas as is, with value type T ?
+    template <typename T, typename A>
+    constexpr bool is_blas_operand_v = is_regular_or_view_v<A> and std::is_same_v<std::remove_const_t<get_value_t<A>>, T>;
+
+    // a itself if it can be passed to blas with value type T, otherwise a copy converted to T in the scratch buffer Slot
+    template <typename T, int Slot, typename A>
+    decltype(auto) as_blas_operand(A const &a) {
+      if constexpr (is_blas_operand_v<T, A>)
+        return a;
+      else
+        return blas::details::pack<Slot, T>(a);
+    }
+
+    // Resize a regular out parameter to shape if necessary, check the shape of a view
+    template <typename Out, size_t R>
+    void resize_or_check(Out &out, std::array<long, R> const &shape) {
+      if constexpr (is_regular_v<Out>) {
+        if (out.shape() != shape) out.resize(shape);
+      } else {
+        EXPECTS_WITH_MESSAGE(out.shape() == shape, "Matrix product : the result has the wrong shape " << out.shape() << " != " << shape);
+      }
+    }
+
+    // Is r the transpose of l, i.e. a view of the same storage with swapped shape and strides, e.g. a * transpose(a) ?
+    // The product is then symmetric, and computed by syrk with half the flops of gemm.
+    template <typename L, typename R>
+    bool is_transposed_pair(L const &l, R const &r) {
+      auto const &ls = l.indexmap().strides();
+      auto const &rs = r.indexmap().strides();
+      return l.data() == r.data() and l.shape()[0] == r.shape()[1] and l.shape()[1] == r.shape()[0] and ls[0] == rs[1] and ls[1] == rs[0]
+         and l.indexmap().min_stride() == 1;
+    }
+
+  } // namespace details
+
+  /**
+   * Compute the matrix product l * r into out, reusing the storage of out.
+   *
+   * Nothing is allocated when called repeatedly with the same shapes :
+   *   * If out is a regular matrix, it is resized only if its shape differs from the shape of the product.
+   *     If it is a view, it must have the shape of the product.
+   *   * The operands which have to be converted to the value type of out (mixed value types, lazy expressions)
+   *     are copied into thread local scratch buffers, reused from one call to the next.
+   *
+   * If r is a transpose view of the storage of l (e.g. a * transpose(a)), the symmetric product is computed with syrk.
+   *
+   * @param out The result. Can be a temporary view (hence the &&). It must not alias l or r.
+   * @param l : lhs, a matrix or a lazy expression
+   * @param r : rhs, a matrix or a lazy expression
+   */
+  template <blas::MatrixView Out, typename L, typename R>
+  void matmul_into(Out &&out, L const &l, R const &r) {
+    using T = get_value_t<std::decay_t<Out>>;
+
+    EXPECTS_WITH_MESSAGE(l.shape()[1] == r.shape()[0], "Matrix product : dimension mismatch in matrix product " << l << " " << r);
+    details::resize_or_check(out, std::array<long, 2>{l.shape()[0], r.shape()[1]});
+
+    if constexpr (blas::is_blas_lapack_v<T>) {
+
+      // MSAN has no way to know that we are calling with beta = 0, hence
+      // this is not necessaru
+      // of course, in production code, we do NOT waste time to do this.
+#if defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+      out = 0;
+#endif
+#endif
+
+      if constexpr (details::is_blas_operand_v<T, L> and details::is_blas_operand_v<T, R>) {
+        if (details::is_transposed_pair(l, r) and out.indexmap().min_stride() == 1) {
+          blas::syrk(1, l, 0, out);
+          return;
+        }
+      }
+      blas::gemm(1, details::as_blas_operand<T, 0>(l), details::as_blas_operand<T, 1>(r), 0, out);
+    } else {
+      blas::gemm_generic(1, l, r, 0, out);
+    }
+  }
+
   /**
    * @tparam L NdArray with algebra 'M' 
    * @tparam R 
@@ -38,32 +121,71 @@ namespace nda {
 
     using promoted_type = decltype(get_value_t<L_t>{} * get_value_t<R_t>{});
     matrix<promoted_type> result(l.shape()[0], r.shape()[1]);
+    matmul_into(result, l, r);
+    return result;
+  }
 
-    if constexpr (blas::is_blas_lapack_v<promoted_type>) {
+  /**
+   * Gram matrix of a, computed with syrk (real) or herk (complex), i.e. with half the flops of the general product.
+   *
+   * @param a A matrix or a lazy expression of rank 2
+   * @param op 'C' : a^H * a (the Gram matrix of the columns of a), 'N' : a * a^H (the Gram matrix of its rows)
+   * @return The hermitian (symmetric) product, with both triangles filled
+   */
+  template <typename A>
+  auto gram(A const &a, char op = 'C') {
+    using T = std::remove_const_t<get_value_t<A>>;
+    static_assert(blas::is_blas_lapack_v<T>, "gram : the element type must be a blas/lapack type");
+    EXPECTS(op == 'C' or op == 'N');
+    long n = a.shape()[op == 'N' ? 0 : 1];
+    matrix<T> result(n, n);
+    auto compute = [&](auto const &a_b) {
+      if constexpr (is_complex_v<T>)
+        blas::herk(1, a_b, 0, result, op);
+      else
+        blas::syrk(1, a_b, 0, result, (op == 'N' ? 'N' : 'T'));
+    };
+    if constexpr (is_regular_or_view_v<A>) {
+      if (a.indexmap().min_stride() == 1) {
+        compute(a);
+        return result;
+      }
+    }
+    compute(matrix<T, F_layout>{a});
+    return result;
+  }
 
-      auto as_container = [](auto const &a) -> decltype(auto) {
-        //FIXMEM C++20 LAMBDA
-        using A = std::decay_t<decltype(a)>;
-        if constexpr (is_regular_or_view_v<A> and std::is_same_v<get_value_t<A>, promoted_type>)
-          return a;
-        else
-          return matrix<promoted_type>{a};
-      };
+  /**
+   * Compute the matrix vector product l * r into out, reusing the storage of out.
+   *
+   * As for matmul_into, nothing is allocated when called repeatedly with the same shapes.
+   *
+   * @param out The result. Can be a temporary view (hence the &&). It must not alias l or r.
+   * @param l : lhs, a matrix or a lazy expression
+   * @param r : rhs, a vector or a lazy expression
+   */
+  template <blas::VectorView Out, typename L, typename R>
+  void matvecmul_into(Out &&out, L const &l, R const &r) {
+    using T = get_value_t<std::decay_t<Out>>;
+
+    EXPECTS_WITH_MESSAGE(l.shape()[1] == r.shape()[0], "Matrix Vector product : dimension mismatch in matrix product " << l << " " << r);
+    details::resize_or_check(out, std::array<long, 1>{l.shape()[0]});
+
+    if constexpr (blas::is_blas_lapack_v<T>) {
 
       // MSAN has no way to know that we are calling with beta = 0, hence
       // this is not necessaru
       // of course, in production code, we do NOT waste time to do this.
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
-      result = 0;
+      out = 0;
 #endif
 #endif
 
-      blas::gemm(1, as_container(l), as_container(r), 0, result);
+      blas::gemv(1, details::as_blas_operand<T, 0>(l), details::as_blas_operand<T, 1>(r), 0, out);
     } else {
-      blas::gemm_generic(1, l, r, 0, result);
+      blas::gemv_generic(1, l, r, 0, out);
     }
-    return result;
   }
 
   /**
@@ -84,31 +206,7 @@ namespace nda {
 
     using promoted_type = decltype(get_value_t<L_t>{} * get_value_t<R_t>{});
     array<promoted_type, 1> result(l.shape()[0]);
-
-    if constexpr (blas::is_blas_lapack_v<promoted_type>) {
-
-      auto as_container = [](auto const &a) -> decltype(auto) {
-        //FIXMEM C++20 LAMBDA
-        using A = std::decay_t<decltype(a)>;
-        if constexpr (is_regular_or_view_v<A> and std::is_same_v<get_value_t<A>, promoted_type>)
-          return a;
-        else
-          return array<promoted_type, get_rank<A>>{a};
-      };
-
-      // MSAN has no way to know that we are calling with beta = 0, hence
-      // this is not necessaru
-      // of course, in production code, we do NOT waste time to do this.
-#if defined(__has_feature)
-#if __has_feature(memory_sanitizer)
-      result = 0;
-#endif
-#endif
-
-      blas::gemv(1, as_container(l), as_container(r), 0, result);
-    } else {
-      blas::gemv_generic(1, l, r, 0, result);
-    }
+    matvecmul_into(result, l, r);
     return result;
   }
 
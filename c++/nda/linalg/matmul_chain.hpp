@@ -0,0 +1,149 @@
+// Copyright (c) 2019-2020 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+#include <limits>
+#include <tuple>
+#include <vector>
+#include "./matmul.hpp"
+
+namespace nda {
+
+  namespace details {
+
+    /**
+     * Optimal parenthesization of the product of N matrices, the matrix i being of shape (p[i], p[i + 1]),
+     * computed by the classic matrix chain dynamic programming, in O(N^3).
+     *
+     * @return split, where split[i][j] = k means that the product of the matrices i..j is best computed
+     *         as (i..k) * (k + 1..j)
+     */
+    template <size_t N>
+    std::array<std::array<long, N>, N> matrix_chain_order(std::array<long, N + 1> const &p) {
+      std::array<std::array<long, N>, N> cost{}, split{};
+      for (long len = 1; len < N; ++len) {
+        for (long i = 0; i + len < N; ++i) {
+          long j     = i + len;
+          cost[i][j] = std::numeric_limits<long>::max();
+          for (long k = i; k < j; ++k) {
+            long c = cost[i][k] + cost[k + 1][j] + p[i] * p[k + 1] * p[j + 1];
+            if (c < cost[i][j]) {
+              cost[i][j]  = c;
+              split[i][j] = k;
+            }
+          }
+        }
+      }
+      return split;
+    }
+
+    // Call f(std::get<I>(t)) for I == i, where i is only known at runtime
+    template <typename Tuple, typename F>
+    void visit_at(Tuple const &t, long i, F const &f) {
+      [&]<size_t... Is>(std::index_sequence<Is...>) { ((i == Is ? f(std::get<Is>(t)) : void()), ...); }
+      (std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+    }
+
+  } // namespace details
+
+  /**
+   * Product of a chain of matrices a_0 * a_1 * ... * a_{N-1}, evaluated in the optimal order.
+   *
+   * operator* evaluates a product chain from left to right, which can be orders of magnitude more
+   * expensive than another order, e.g. dagger(U) * M * U * v. matmul_chain chooses the parenthesization
+   * minimizing the number of multiplications from the shapes of the operands, and evaluates it with
+   * matmul_into, reusing the storage of the intermediate products between the steps.
+   *
+   * @param a The matrices (or lazy expressions of rank 2). The last one may be a vector, in which case the result is a vector.
+   * @return The product, as a matrix (or a vector)
+   */
+  template <typename... A>
+  auto matmul_chain(A const &...a) {
+    constexpr long N = sizeof...(A);
+    static_assert(N >= 2, "matmul_chain : at least two operands are required");
+
+    using last_t                 = std::decay_t<std::tuple_element_t<N - 1, std::tuple<A...>>>;
+    static constexpr bool vector = (get_rank<last_t> == 1);
+    using T                      = decltype((get_value_t<A>{} * ...));
+    static_assert([]<size_t... Is>(std::index_sequence<Is...>) { return ((get_rank<std::tuple_element_t<Is, std::tuple<A...>>> == 2) and ...); }
+                  (std::make_index_sequence<N - 1>{}),
+                  "matmul_chain : all operands but the last must be matrices");
+
+    auto ops = std::tie(a...);
+
+    // The shapes : operand i is of shape (p[i], p[i + 1]). A vector is seen as a matrix with one column.
+    std::array<long, N + 1> p;
+    for (long i = 0; i < N; ++i) details::visit_at(ops, i, [&](auto const &x) { p[i] = x.shape()[0]; });
+    p[N] = 1;
+    if constexpr (not vector) p[N] = std::get<N - 1>(ops).shape()[1];
+    for (long i = 0; i < N - 1; ++i) {
+      details::visit_at(ops, i, [&](auto const &x) {
+        if constexpr (get_rank<std::decay_t<decltype(x)>> == 2)
+          EXPECTS_WITH_MESSAGE(x.shape()[1] == p[i + 1], "Matrix product : dimension mismatch in the product chain at operand " << i);
+      });
+    }
+
+    auto split = details::matrix_chain_order<N>(p);
+
+    // The intermediate products. They are reused between the steps, preferably with the same size to avoid a reallocation.
+    std::vector<matrix<T>> pool;
+    auto get_tmp = [&pool](long size) {
+      if (pool.empty()) return matrix<T>{};
+      auto it = std::find_if(pool.begin(), pool.end(), [size](auto const &m) { return m.size() == size; });
+      if (it == pool.end()) it = pool.end() - 1;
+      auto m = std::move(*it);
+      pool.erase(it);
+      return m;
+    };
+
+    auto eval_chain = [&](auto const &leaves) {
+      // Product of the operands i..j, i < j
+      auto eval = [&](auto const &self, long i, long j) -> matrix<T> {
+        long k = split[i][j];
+        std::vector<matrix<T>> children;
+        if (k > i) children.push_back(self(self, i, k));
+        if (k + 1 < j) children.push_back(self(self, k + 1, j));
+
+        auto out = get_tmp(p[i] * p[j + 1]);
+        if (k == i and k + 1 == j)
+          details::visit_at(leaves, i, [&](auto const &l) { details::visit_at(leaves, j, [&](auto const &r) { matmul_into(out, l, r); }); });
+        else if (k == i)
+          details::visit_at(leaves, i, [&](auto const &l) { matmul_into(out, l, children[0]); });
+        else if (k + 1 == j)
+          details::visit_at(leaves, j, [&](auto const &r) { matmul_into(out, children[0], r); });
+        else
+          matmul_into(out, children[0], children[1]);
+
+        for (auto &c : children) pool.push_back(std::move(c));
+        return out;
+      };
+      return eval(eval, 0, N - 1);
+    };
+
+    if constexpr (vector) {
+      // The vector as a matrix with one column
+      matrix<T> v(p[N - 1], 1);
+      v(range::all, 0) = std::get<N - 1>(ops);
+      auto leaves      = [&]<size_t... Is>(std::index_sequence<Is...>) { return std::tie(std::get<Is>(ops)..., v); }
+      (std::make_index_sequence<N - 1>{});
+      auto res = eval_chain(leaves);
+      return array<T, 1>{res(range::all, 0)};
+    } else {
+      return eval_chain(ops);
+    }
+  }
+
+} // namespace nda
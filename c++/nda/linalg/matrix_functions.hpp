@@ -0,0 +1,257 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "../blas/gemm.hpp"
+#include "../matrix_functions.hpp"
+#include "./eigenelements.hpp"
+#include "./lu_factorization.hpp"
+
+namespace nda::linalg {
+
+  namespace details {
+
+    // The 1-norm (maximum absolute column sum) of a matrix
+    template <typename M>
+    double norm_1(M const &m) {
+      double r = 0;
+      for (long j = 0; j < m.extent(1); ++j) {
+        double s = 0;
+        for (long i = 0; i < m.extent(0); ++i) s += std::abs(m(i, j));
+        r = std::max(r, s);
+      }
+      return r;
+    }
+
+    // Coefficients of the numerator of the [m/m] Pade approximant of exp, for m = 3, 5, 7, 9, 13
+    // and the largest 1-norms for which it reaches double precision (Higham, SIAM J. Matrix Anal. Appl. 26, 1179 (2005))
+    inline constexpr std::array<double, 4> pade_3  = {120., 60., 12., 1.};
+    inline constexpr std::array<double, 6> pade_5  = {30240., 15120., 3360., 420., 30., 1.};
+    inline constexpr std::array<double, 8> pade_7  = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+    inline constexpr std::array<double, 10> pade_9 = {17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+                                                      2162160.,     110880.,      3960.,        90.,        1.};
+    inline constexpr std::array<double, 14> pade_13 = {64764752532480000., 32382376266240000., 7771770303897600., 1187353796428800., 129060195264000.,
+                                                       10559470521600.,    670442572800.,      33522128640.,     1323241920.,      40840800.,
+                                                       960960.,            16380.,             182.,             1.};
+    inline constexpr std::array<double, 5> pade_theta = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1, 2.097847961257068e0,
+                                                         5.371920351148152e0};
+
+  } // namespace details
+
+  /**
+   * Exponential of a square matrix, by scaling and squaring with a [m/m] Pade approximant (m = 3, 5, 7, 9 or 13, chosen from the 1-norm).
+   *
+   * The cost is a few gemm and one LU solve, plus one gemm per squaring for matrices of large norm.
+   * For a hermitian matrix, or to compute several functions of the same matrix, cf. hermitian_eigensystem.
+   *
+   * @param a The matrix, a view or a lazy expression
+   * @return exp(a)
+   */
+  template <ArrayOfRank<2> A>
+  matrix<get_value_t<A>, F_layout> expm(A const &a) {
+    using T     = get_value_t<A>;
+    using mat_t = matrix<T, F_layout>;
+    static_assert(blas::is_blas_lapack_v<T>, "expm : element type must be a blas/lapack type");
+    EXPECTS(is_matrix_square(a, true));
+
+    auto x = mat_t{a};
+    long n = x.extent(0);
+    if (n == 0) return x;
+
+    auto id         = mat_t{eye<T>(n)};
+    double norm     = details::norm_1(x);
+    auto const &b13 = details::pade_13;
+    mat_t u, v;
+
+    // u = x * (b_1 + b_3 x^2 + ...), v = b_0 + b_2 x^2 + ..., with the powers of x^2 computed one by one
+    auto pade_low = [&](auto const &b) {
+      auto x2 = mat_t{x * x};
+      auto p  = id;
+      auto uu = mat_t{T(b[1]) * id};
+      v       = T(b[0]) * id;
+      for (size_t k = 2; k < b.size(); k += 2) {
+        p = (k == 2 ? x2 : mat_t{p * x2});
+        v += T(b[k]) * p;
+        uu += T(b[k + 1]) * p;
+      }
+      u = x * uu;
+    };
+
+    int s = 0;
+    if (norm <= details::pade_theta[0]) {
+      pade_low(details::pade_3);
+    } else if (norm <= details::pade_theta[1]) {
+      pade_low(details::pade_5);
+    } else if (norm <= details::pade_theta[2]) {
+      pade_low(details::pade_7);
+    } else if (norm <= details::pade_theta[3]) {
+      pade_low(details::pade_9);
+    } else {
+      // Scale x so that its norm is below theta_13, and evaluate the [13/13] approximant with 6 products
+      if (norm > details::pade_theta[4]) s = static_cast<int>(std::ceil(std::log2(norm / details::pade_theta[4])));
+      x /= T(std::ldexp(1.0, s));
+      auto x2 = mat_t{x * x};
+      auto x4 = mat_t{x2 * x2};
+      auto x6 = mat_t{x4 * x2};
+      auto w  = mat_t{T(b13[13]) * x6 + T(b13[11]) * x4 + T(b13[9]) * x2};
+      auto z  = mat_t{T(b13[12]) * x6 + T(b13[10]) * x4 + T(b13[8]) * x2};
+      auto uu = mat_t{x6 * w};
+      uu += T(b13[7]) * x6 + T(b13[5]) * x4 + T(b13[3]) * x2 + T(b13[1]) * id;
+      u = x * uu;
+      v = x6 * z;
+      v += T(b13[6]) * x6 + T(b13[4]) * x4 + T(b13[2]) * x2 + T(b13[0]) * id;
+    }
+
+    // r = (v - u)^{-1} (v + u), then squared s times
+    auto lu = lu_factorization<T, F_layout>{mat_t{v - u}};
+    if (lu.is_singular()) NDA_RUNTIME_ERROR << "Error in expm : singular Pade denominator. getrf info = " << lu.info();
+    mat_t r = lu.solve(mat_t{v + u});
+    for (int k = 0; k < s; ++k) r = r * r;
+    return r;
+  }
+
+  //--------------------------------
+
+  /**
+   * Eigendecomposition H = V * diag(lambda) * V^H of a symmetric (real) or hermitian (complex) matrix,
+   * computed once (lapack syev/heev), from which any function f(H) = V * diag(f(lambda)) * V^H
+   * is then reassembled with a single gemm.
+   *
+   * Typical use is a time propagation, where exp(-i H dt) is needed for several dt, or several functions of the same matrix.
+   *
+   * @tparam T Element type of the matrix (float, double or their complex counterparts)
+   */
+  template <typename T>
+  class hermitian_eigensystem {
+    static_assert(blas::is_blas_lapack_v<T>, "hermitian_eigensystem: element type must be a blas/lapack type");
+
+    using real_t = blas::real_value_t<T>;
+
+    // The eigenvalues, in ascending order
+    array<real_t, 1> _ev;
+
+    // The eigenvectors, as columns
+    matrix<T, F_layout> _vecs;
+
+    public:
+    /**
+     * Diagonalize a copy of the matrix h. Only its upper triangle is read.
+     * @param h A symmetric (real) or hermitian (complex) matrix, a view or a lazy expression
+     */
+    template <ArrayOfRank<2> M>
+    explicit hermitian_eigensystem(M const &h) : _vecs(h) {
+      EXPECTS(is_matrix_square(_vecs, true));
+      if (not _vecs.empty()) _ev = eigenelements_in_place(_vecs);
+    }
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const { return _vecs.extent(0); }
+
+    /// The eigenvalues, in ascending order
+    [[nodiscard]] array<real_t, 1> const &eigenvalues() const { return _ev; }
+
+    /// The eigenvectors, as columns
+    [[nodiscard]] matrix<T, F_layout> const &eigenvectors() const { return _vecs; }
+
+    /**
+     * f(H) = V * diag(f(lambda)) * V^H
+     *
+     * @param f A function of a real eigenvalue. It may return a complex value for a real matrix, e.g. exp(-i x dt),
+     *          in which case the result is complex.
+     * @return f(H), in Fortran order
+     */
+    template <typename F>
+    auto apply(F const &f) const {
+      using U = decltype(T{} * f(real_t{}));
+      long n  = dim();
+
+      // w = V * diag(f(lambda)), and V^H, then one gemm
+      auto w = matrix<U, F_layout>(n, n);
+      for (long j = 0; j < n; ++j) {
+        U fj = f(_ev(j));
+        for (long i = 0; i < n; ++i) w(i, j) = _vecs(i, j) * fj;
+      }
+      auto vh = matrix<U, F_layout>(n, n);
+      for (long j = 0; j < n; ++j)
+        for (long i = 0; i < n; ++i) vh(i, j) = conj(_vecs(j, i));
+
+      auto r = matrix<U, F_layout>(n, n);
+      if (n > 0) blas::gemm(U{1}, w, vh, U{0}, r);
+      return r;
+    }
+
+    /// exp(s * H), for a real or complex s (e.g. s = -i dt for a time propagation)
+    template <typename S = real_t>
+    auto exp(S const &s = S{1}) const {
+      return apply([s](real_t x) { return std::exp(s * x); });
+    }
+
+    /// The square root of H, which must be positive semi-definite (up to rounding errors)
+    [[nodiscard]] auto sqrt() const {
+      real_t tol = 100 * std::numeric_limits<real_t>::epsilon() * max_abs_eigenvalue();
+      for (auto x : _ev)
+        if (x < -tol) NDA_RUNTIME_ERROR << "Error in hermitian_eigensystem::sqrt : the matrix is not positive semi-definite. Eigenvalue " << x;
+      return apply([](real_t x) { return std::sqrt(std::max(x, real_t{0})); });
+    }
+
+    /// The principal logarithm of H, which must be positive definite
+    [[nodiscard]] auto log() const {
+      for (auto x : _ev)
+        if (x <= 0) NDA_RUNTIME_ERROR << "Error in hermitian_eigensystem::log : the matrix is not positive definite. Eigenvalue " << x;
+      return apply([](real_t x) { return std::log(x); });
+    }
+
+    private:
+    [[nodiscard]] real_t max_abs_eigenvalue() const { return (dim() == 0 ? real_t{0} : std::max(std::abs(_ev(0)), std::abs(_ev(dim() - 1)))); }
+  };
+
+  /// Deduction guide : diagonalize a copy of any matrix or rank 2 array
+  template <ArrayOfRank<2> M>
+  hermitian_eigensystem(M const &) -> hermitian_eigensystem<get_value_t<M>>;
+
+  //--------------------------------
+
+  /**
+   * f(H) for a symmetric (real) or hermitian (complex) matrix H, via its eigendecomposition, cf. hermitian_eigensystem::apply.
+   * To evaluate several functions of the same matrix, construct a hermitian_eigensystem once instead.
+   */
+  template <ArrayOfRank<2> M, typename F>
+  auto funm_hermitian(M const &h, F const &f) {
+    return hermitian_eigensystem{h}.apply(f);
+  }
+
+  /// exp(s * H) for a symmetric (real) or hermitian (complex) matrix H, via its eigendecomposition
+  template <ArrayOfRank<2> M, typename S = blas::real_value_t<get_value_t<M>>>
+  auto expm_hermitian(M const &h, S const &s = S{1}) {
+    return hermitian_eigensystem{h}.exp(s);
+  }
+
+  /// The square root of a symmetric (real) or hermitian (complex) positive semi-definite matrix, via its eigendecomposition
+  template <ArrayOfRank<2> M>
+  auto sqrtm_hermitian(M const &h) {
+    return hermitian_eigensystem{h}.sqrt();
+  }
+
+  /// The principal logarithm of a symmetric (real) or hermitian (complex) positive definite matrix, via its eigendecomposition
+  template <ArrayOfRank<2> M>
+  auto logm_hermitian(M const &h) {
+    return hermitian_eigensystem{h}.log();
+  }
+
+} // namespace nda::linalg
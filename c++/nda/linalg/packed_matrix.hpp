@@ -0,0 +1,214 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include "../blas/spmv.hpp"
+#include "../lapack.hpp"
+#include "../layout/packed_idx_map.hpp"
+#include "./det_and_inverse.hpp"
+
+namespace nda {
+
+  /**
+   * Symmetric (real) or hermitian (complex) matrix, of which only the upper triangle is stored,
+   * in the lapack packed storage (cf. packed_idx_map) : n * (n + 1) / 2 elements instead of n * n.
+   *
+   * Element access, conversion from and to dense matrices, products with vectors and matrices (blas spmv/hpmv),
+   * rank 1 updates (blas spr/hpr), linear solves (lapack sptrf/hptrf) and eigenelements (lapack spev/hpev) are provided.
+   *
+   * @tparam T Element type
+   */
+  template <typename T>
+  class packed_matrix {
+    packed_idx_map _idx;
+    array<T, 1> _data;
+
+    public:
+    using value_type = T;
+
+    /// An empty 0 x 0 matrix
+    packed_matrix() = default;
+
+    /// A n x n matrix. The elements are not initialized.
+    explicit packed_matrix(long n) : _idx{n, 'U'}, _data(_idx.size()) {}
+
+    /**
+     * Pack a dense matrix. Only its upper triangle is read : the matrix is assumed to be symmetric (hermitian).
+     * @param m A matrix, a view or a lazy expression
+     */
+    template <ArrayOfRank<2> M>
+    explicit packed_matrix(M const &m) : packed_matrix(m.shape()[0]) {
+      EXPECTS(is_matrix_square(m, true));
+      for (long j = 0; j < dim(); ++j)
+        for (long i = 0; i <= j; ++i) _data(_idx(i, j)) = m(i, j);
+    }
+
+    /// The n x n zero matrix
+    static packed_matrix zeros(long n) {
+      auto r  = packed_matrix(n);
+      r._data = 0;
+      return r;
+    }
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const { return _idx.dim(); }
+
+    /// Shape of the matrix
+    [[nodiscard]] std::array<long, 2> shape() const { return _idx.lengths(); }
+
+    /// The mapping of the upper triangle onto the packed storage
+    [[nodiscard]] packed_idx_map const &indexmap() const { return _idx; }
+
+    /// The packed storage
+    [[nodiscard]] array_view<T, 1> data() { return _data; }
+
+    /// The packed storage
+    [[nodiscard]] array_const_view<T, 1> data() const { return _data; }
+
+    /// The element (i, j), for any i, j
+    [[nodiscard]] T operator()(long i, long j) const { return (i <= j ? _data(_idx(i, j)) : conj(_data(_idx(j, i)))); }
+
+    /// The stored element (i, j) of the upper triangle (i <= j). The element (j, i) is its complex conjugate.
+    [[nodiscard]] T &upper(long i, long j) { return _data(_idx(i, j)); }
+
+    /// Write the full dense matrix into out, which must have the shape of the matrix
+    template <MemoryArrayOfRank<2> Out>
+    void to_dense(Out &&out) const {
+      EXPECTS_WITH_MESSAGE(out.shape() == shape(), "packed_matrix::to_dense : shape mismatch " << out.shape() << " != " << shape());
+      for (long j = 0; j < dim(); ++j)
+        for (long i = 0; i < dim(); ++i) out(i, j) = (*this)(i, j);
+    }
+
+    /// The full dense matrix
+    [[nodiscard]] matrix<T> to_dense() const {
+      auto r = matrix<T>(dim(), dim());
+      to_dense(r);
+      return r;
+    }
+
+    /// Rank 1 update A += alpha * x * x^H, with blas spr/hpr
+    template <ArrayOfRank<1> X>
+    void rank1_update(blas::real_value_t<T> alpha, X const &x) {
+      if constexpr (is_regular_or_view_v<X>)
+        blas::spr(alpha, x, _data);
+      else
+        blas::spr(alpha, array<T, 1>{x}, _data);
+    }
+
+    // ------------- Arithmetic ------------------
+
+    packed_matrix &operator+=(packed_matrix const &y) {
+      EXPECTS(dim() == y.dim());
+      _data += y._data;
+      return *this;
+    }
+
+    packed_matrix &operator-=(packed_matrix const &y) {
+      EXPECTS(dim() == y.dim());
+      _data -= y._data;
+      return *this;
+    }
+
+    /// Multiplication by a real scalar, which keeps the matrix hermitian
+    packed_matrix &operator*=(blas::real_value_t<T> const &s) {
+      _data *= s;
+      return *this;
+    }
+
+    friend packed_matrix operator+(packed_matrix x, packed_matrix const &y) {
+      x += y;
+      return x;
+    }
+    friend packed_matrix operator-(packed_matrix x, packed_matrix const &y) {
+      x -= y;
+      return x;
+    }
+
+    /// Product with a dense vector (blas spmv/hpmv), or with a dense matrix, column by column
+    template <Array X>
+    friend auto operator*(packed_matrix const &a, X const &x) {
+      static_assert(get_rank<X> == 1 or get_rank<X> == 2, "packed_matrix * x : x must be a vector or a matrix");
+      static_assert(std::is_same_v<get_value_t<X>, T>, "packed_matrix * x : x must have the element type of the matrix");
+      EXPECTS_WITH_MESSAGE(x.shape()[0] == a.dim(), "packed_matrix * x : dimension mismatch");
+      auto xx = make_regular(x);
+      if constexpr (get_rank<X> == 1) {
+        auto r = vector<T>(a.dim());
+        blas::spmv(T{1}, a._data, xx, T{0}, r);
+        return r;
+      } else {
+        auto r = matrix<T, F_layout>(a.dim(), xx.extent(1));
+        for (long j = 0; j < xx.extent(1); ++j) blas::spmv(T{1}, a._data, xx(range(), j), T{0}, r(range(), j));
+        return r;
+      }
+    }
+  };
+
+} // namespace nda
+
+namespace nda::linalg {
+
+  /**
+   * Eigenvalues and eigenvectors of a packed symmetric (real) or hermitian (complex) matrix, with lapack spev/hpev.
+   * @return Pair consisting of the eigenvalues in ascending order and the matrix containing the eigenvectors as columns
+   */
+  template <typename T>
+  std::pair<array<blas::real_value_t<T>, 1>, matrix<T, F_layout>> eigenelements(packed_matrix<T> const &m) {
+    auto ap   = array<T, 1>{m.data()};
+    auto ev   = array<blas::real_value_t<T>, 1>(m.dim());
+    auto vecs = matrix<T, F_layout>(m.dim(), m.dim());
+    if (m.dim() == 0) return {ev, vecs};
+    int info = lapack::spev(ap, ev, vecs);
+    if (info != 0) NDA_RUNTIME_ERROR << "Error in eigenelements : spev info = " << info;
+    return {std::move(ev), std::move(vecs)};
+  }
+
+  /// Eigenvalues of a packed symmetric (real) or hermitian (complex) matrix, in ascending order, with lapack spev/hpev
+  template <typename T>
+  array<blas::real_value_t<T>, 1> eigenvalues(packed_matrix<T> const &m) {
+    auto ap = array<T, 1>{m.data()};
+    auto ev = array<blas::real_value_t<T>, 1>(m.dim());
+    if (m.dim() == 0) return ev;
+    int info = lapack::spev(ap, ev, matrix<T, F_layout>{});
+    if (info != 0) NDA_RUNTIME_ERROR << "Error in eigenvalues : spev info = " << info;
+    return ev;
+  }
+
+  /**
+   * Solve A * X = B for a packed symmetric (real) or hermitian (complex) matrix A,
+   * with the Bunch-Kaufman factorization of lapack sptrf/hptrf. A needs not be positive definite.
+   *
+   * @param a The matrix
+   * @param b A vector or a matrix (one right hand side per column)
+   * @return The solution X, with the shape of b
+   */
+  template <typename T, Array B>
+  auto solve(packed_matrix<T> const &a, B const &b) {
+    static_assert(get_rank<B> == 1 or get_rank<B> == 2, "solve : b must be a vector or a matrix");
+    static_assert(std::is_same_v<get_value_t<B>, T>, "solve : b must have the element type of the matrix");
+    EXPECTS_WITH_MESSAGE(b.shape()[0] == a.dim(), "solve : dimension mismatch");
+    auto x = basic_array<T, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+    if (a.dim() == 0) return x;
+
+    auto ap   = array<T, 1>{a.data()};
+    auto ipiv = array<int, 1>(a.dim());
+    int info  = lapack::sptrf(ap, ipiv);
+    if (info != 0) NDA_RUNTIME_ERROR << "Error in solve : the packed matrix is singular. sptrf info = " << info;
+    info = lapack::sptrs(ap, ipiv, x);
+    if (info != 0) NDA_RUNTIME_ERROR << "Error in solve : sptrs info = " << info;
+    return x;
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,169 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include <tuple>
+
+#include "../lapack.hpp"
+#include "./for_each_block.hpp"
+
+namespace nda::linalg {
+
+  namespace details {
+
+    // The R factor (n_rows x N) from the upper trapezoid of w, as returned by geqrf/geqp3
+    template <typename T>
+    matrix<T, F_layout> extract_r(matrix<T, F_layout> const &w, long n_rows) {
+      auto r = matrix<T, F_layout>::zeros({n_rows, w.extent(1)});
+      for (long j = 0; j < w.extent(1); ++j)
+        for (long i = 0; i <= std::min(j, std::min(n_rows, w.extent(0)) - 1); ++i) r(i, j) = w(i, j);
+      return r;
+    }
+
+    // The Q factor (M x (thin ? K : M)) from the reflectors returned by geqrf/geqp3 in w, which is reused when possible
+    template <typename T>
+    matrix<T, F_layout> extract_q(matrix<T, F_layout> &&w, array<T, 1> const &tau, bool thin) {
+      long m = w.extent(0), n = w.extent(1), k = std::min(m, n);
+      long nq = (thin ? k : m);
+      if (nq == n) {
+        lapack::orgqr(w, tau);
+        return std::move(w);
+      }
+      auto q                     = matrix<T, F_layout>(m, nq);
+      q(range::all, range(0, k)) = w(range::all, range(0, k));
+      lapack::orgqr(q, tau);
+      return q;
+    }
+
+  } // namespace details
+
+  /**
+   * QR factorization A = Q * R (lapack geqrf, then orgqr/ungqr).
+   *
+   * @param a The M x N matrix, a view or a lazy expression
+   * @param thin If true (default), the economy size factorization : Q is M x K and R is K x N, K = min(M, N).
+   *             If false, Q is M x M and R is M x N.
+   * @return Pair (Q, R) : Q has orthonormal columns, R is upper triangular (trapezoidal)
+   */
+  template <ArrayOfRank<2> A>
+  auto qr(A const &a, bool thin = true) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "qr : element type must be a blas/lapack type");
+    auto w   = matrix<T, F_layout>{a};
+    long m   = w.extent(0), k = std::min(m, w.extent(1));
+    auto tau = array<T, 1>{};
+    lapack::geqrf(w, tau);
+    auto r = details::extract_r(w, (thin ? k : m));
+    auto q = details::extract_q(std::move(w), tau, thin);
+    return std::make_pair(std::move(q), std::move(r));
+  }
+
+  /**
+   * QR factorization with column pivoting A(:, perm) = Q * R (lapack geqp3, then orgqr/ungqr).
+   *
+   * The columns are permuted so that the magnitudes of the diagonal of R decrease, revealing the numerical rank of A.
+   * The first columns of perm are the most linearly independent columns of A, e.g. for interpolative decompositions.
+   *
+   * @param a The M x N matrix, a view or a lazy expression
+   * @param thin Cf. qr
+   * @return Tuple (Q, R, perm), perm being the 0-based column permutation
+   */
+  template <ArrayOfRank<2> A>
+  auto qr_pivoted(A const &a, bool thin = true) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "qr_pivoted : element type must be a blas/lapack type");
+    auto w    = matrix<T, F_layout>{a};
+    long m    = w.extent(0), n = w.extent(1), k = std::min(m, n);
+    auto tau  = array<T, 1>{};
+    auto jpvt = array<int, 1>::zeros({n});
+    lapack::geqp3(w, jpvt, tau);
+    auto r    = details::extract_r(w, (thin ? k : m));
+    auto q    = details::extract_q(std::move(w), tau, thin);
+    auto perm = array<long, 1>(n);
+    for (long j = 0; j < n; ++j) perm(j) = jpvt(j) - 1;
+    return std::make_tuple(std::move(q), std::move(r), std::move(perm));
+  }
+
+  /**
+   * Thin QR factorization A = Q * R in place, e.g. to orthonormalize a set of vectors at blas 3 speed.
+   *
+   * @param a The M x N matrix (M >= N), overwritten by Q with orthonormal columns.
+   *          A matrix in Fortran order with unit smallest stride is factorized directly, otherwise through a copy.
+   * @return R, the N x N upper triangular factor
+   */
+  template <MemoryArrayOfRank<2> A>
+  auto qr_in_place(A &&a) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "qr_in_place : element type must be a blas/lapack type");
+    EXPECTS_WITH_MESSAGE(a.extent(0) >= a.extent(1), "qr_in_place : the matrix must have at least as many rows as columns");
+
+    auto tau = array<T, 1>{};
+    if constexpr (std::decay_t<A>::is_stride_order_Fortran()) {
+      if (a.indexmap().min_stride() == 1) {
+        lapack::geqrf(a, tau);
+        auto r = matrix<T, F_layout>::zeros({a.extent(1), a.extent(1)});
+        for (long j = 0; j < a.extent(1); ++j)
+          for (long i = 0; i <= j; ++i) r(i, j) = a(i, j);
+        lapack::orgqr(a, tau);
+        return r;
+      }
+    }
+    auto [q, r] = qr(a);
+    a           = q;
+    return r;
+  }
+
+  /**
+   * Batched thin QR factorizations in place, cf. qr_in_place.
+   * The matrices are distributed over the OpenMP threads (when compiled with OpenMP).
+   *
+   * @param a Array of shape (n_batch, M, N), M >= N : a(b, _, _) is overwritten by its Q factor
+   * @return The R factors, of shape (n_batch, N, N)
+   */
+  template <MemoryArrayOfRank<3> A>
+  auto qr_in_place(A &&a) {
+    using T         = get_value_t<A>;
+    auto [nb, m, n] = a.shape();
+    auto r          = array<T, 3>(nb, n, n);
+    nda::details::for_each_block(nb, nb * m * n * n, [&](long b) { r(b, range::all, range::all) = qr_in_place(a(b, range::all, range::all)); });
+    return r;
+  }
+
+  /**
+   * Batched QR factorizations, cf. qr.
+   * The matrices are distributed over the OpenMP threads (when compiled with OpenMP).
+   *
+   * @param a Array of shape (n_batch, M, N)
+   * @param thin Cf. qr
+   * @return Pair (Q, R) of arrays of shapes (n_batch, M, K) and (n_batch, K, N), K = min(M, N) (thin),
+   *         or (n_batch, M, M) and (n_batch, M, N)
+   */
+  template <MemoryArrayOfRank<3> A>
+  auto qr_batched(A const &a, bool thin = true) {
+    using T         = get_value_t<A>;
+    auto [nb, m, n] = a.shape();
+    long nq         = (thin ? std::min(m, n) : m);
+    auto q          = array<T, 3>(nb, m, nq);
+    auto r          = array<T, 3>(nb, nq, n);
+    nda::details::for_each_block(nb, nb * m * n * std::min(m, n), [&](long b) {
+      auto [qb, rb]                = qr(a(b, range::all, range::all), thin);
+      q(b, range::all, range::all) = qb;
+      r(b, range::all, range::all) = rb;
+    });
+    return std::make_pair(std::move(q), std::move(r));
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,148 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <tuple>
+
+#include "../blas/gemm.hpp"
+#include "../lapack.hpp"
+#include "./qr.hpp"
+#include "./svd.hpp"
+
+namespace nda::linalg {
+
+  namespace details {
+
+    // A m x n matrix of independent standard normal numbers (real and imaginary parts for complex types)
+    template <typename T>
+    matrix<T, F_layout> gaussian_matrix(long m, long n, std::mt19937_64 &gen) {
+      auto dist = std::normal_distribution<blas::real_value_t<T>>{};
+      auto r    = matrix<T, F_layout>(m, n);
+      for (long j = 0; j < n; ++j)
+        for (long i = 0; i < m; ++i) {
+          if constexpr (is_complex_v<T>)
+            r(i, j) = T{dist(gen), dist(gen)};
+          else
+            r(i, j) = dist(gen);
+        }
+      return r;
+    }
+
+    // Q^H * A, with one gemm (Q^H is small : it is materialized)
+    template <typename T, typename A>
+    matrix<T, F_layout> adjoint_product(matrix<T, F_layout> const &q, A const &a) {
+      auto qh = matrix<T, F_layout>{dagger(q)};
+      auto r  = matrix<T, F_layout>(q.extent(1), a.extent(1));
+      blas::gemm(T{1}, qh, a, T{0}, r);
+      return r;
+    }
+
+    // The range finder on a matrix or a view a, cf. randomized_range_finder
+    template <typename A>
+    auto randomized_range_finder_impl(A const &a, long l, long n_power_iter, std::mt19937_64 &gen) {
+      using T = get_value_t<A>;
+      long m = a.extent(0), n = a.extent(1);
+
+      // Y = A * Omega
+      auto omega = gaussian_matrix<T>(n, l, gen);
+      auto q     = matrix<T, F_layout>(m, l);
+      blas::gemm(T{1}, a, omega, T{0}, q);
+      qr_in_place(q);
+
+      // Power iterations Y = (A A^H)^p A Omega, orthonormalized at each step to keep the small singular directions
+      for (long it = 0; it < n_power_iter; ++it) {
+        auto z = matrix<T, F_layout>{dagger(adjoint_product(q, a))};
+        qr_in_place(z);
+        blas::gemm(T{1}, a, z, T{0}, q);
+        qr_in_place(q);
+      }
+      return q;
+    }
+
+    inline std::mt19937_64 make_generator(std::optional<std::uint64_t> seed) { return std::mt19937_64(seed ? *seed : std::random_device{}()); }
+
+    // A matrix or a view is used directly by gemm. A lazy expression is evaluated first.
+    template <typename A, typename F>
+    auto with_memory_matrix(A const &a, F f) {
+      if constexpr (MemoryArray<A>)
+        return f(a());
+      else
+        return f(matrix<get_value_t<A>, F_layout>{a});
+    }
+
+  } // namespace details
+
+  /**
+   * Randomized range finder (Halko, Martinsson, Tropp, SIAM Rev. 53, 217 (2011)) :
+   * a M x l matrix Q with orthonormal columns such that Q * Q^H * A approximates A.
+   *
+   * The cost is dominated by 2 * n_power_iter + 1 products of A with M x l or N x l matrices (blas gemm),
+   * and QR factorizations of these tall matrices (cf. qr_in_place).
+   *
+   * @param a The M x N matrix, a view or a lazy expression
+   * @param l The number of columns of Q, l <= min(M, N)
+   * @param n_power_iter The number of power iterations, which improve the accuracy when the singular values decay slowly
+   * @param seed Seed of the random generator, for reproducible results. If not provided, a random seed is used.
+   */
+  template <ArrayOfRank<2> A>
+  auto randomized_range_finder(A const &a, long l, long n_power_iter = 2, std::optional<std::uint64_t> seed = {}) {
+    static_assert(blas::is_blas_lapack_v<get_value_t<A>>, "randomized_range_finder : element type must be a blas/lapack type");
+    EXPECTS(l >= 0 and l <= std::min(a.shape()[0], a.shape()[1]));
+    EXPECTS(n_power_iter >= 0);
+    auto gen = details::make_generator(seed);
+    return details::with_memory_matrix(a, [&](auto const &av) { return details::randomized_range_finder_impl(av, l, n_power_iter, gen); });
+  }
+
+  /**
+   * Randomized truncated SVD A ~ U * diag(S) * VT, keeping the k largest singular triplets
+   * (Halko, Martinsson, Tropp, SIAM Rev. 53, 217 (2011)).
+   *
+   * The range of A is sampled with k + oversampling random vectors (cf. randomized_range_finder),
+   * A is projected onto it and the small projected matrix is decomposed with a dense SVD (lapack gesdd).
+   * All the products with A are blas gemm, multithreaded by the blas library.
+   *
+   * @param a The M x N matrix, a view or a lazy expression
+   * @param k The number of singular triplets, k <= min(M, N)
+   * @param oversampling The number of additional random samples
+   * @param n_power_iter The number of power iterations, which improve the accuracy when the singular values decay slowly
+   * @param seed Seed of the random generator, for reproducible results. If not provided, a random seed is used.
+   * @return Tuple (U, S, VT) : U is M x k, S the k largest singular values in descending order, VT is k x N
+   */
+  template <ArrayOfRank<2> A>
+  auto randomized_svd(A const &a, long k, long oversampling = 10, long n_power_iter = 2, std::optional<std::uint64_t> seed = {}) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "randomized_svd : element type must be a blas/lapack type");
+    long m = a.shape()[0], n = a.shape()[1];
+    EXPECTS(k >= 0 and k <= std::min(m, n));
+    EXPECTS(oversampling >= 0 and n_power_iter >= 0);
+    long l   = std::min(k + oversampling, std::min(m, n));
+    auto gen = details::make_generator(seed);
+
+    return details::with_memory_matrix(a, [&](auto const &av) {
+      auto q = details::randomized_range_finder_impl(av, l, n_power_iter, gen);
+
+      // B = Q^H * A = Ub * diag(S) * VT, hence A ~ (Q * Ub) * diag(S) * VT
+      auto [ub, s, vt] = svd(details::adjoint_product(q, av));
+      auto u           = matrix<T, F_layout>(m, k);
+      blas::gemm(T{1}, q, ub(range::all, range(0, k)), T{0}, u);
+      return std::make_tuple(std::move(u), array<blas::real_value_t<T>, 1>{s(range(0, k))}, matrix<T, F_layout>{vt(range(0, k), range::all)});
+    });
+  }
+
+} // namespace nda::linalg
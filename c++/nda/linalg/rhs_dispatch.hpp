@@ -0,0 +1,74 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include "../blas/tools.hpp"
+
+namespace nda::linalg::details {
+
+  /**
+   * Apply a lapack-style solver in place to the right hand side(s) b.
+   *
+   * The solver is called as solver(T *b, int nrhs, int ldb) on a Fortran ordered matrix
+   * (or a vector) with unit smallest stride. Operands which are not lapack compatible
+   * are solved through a Fortran ordered copy.
+   *
+   * @param b A vector (one right hand side), a matrix (one right hand side per column)
+   *          or a rank 3 array of shape (n_batch, N, NRHS), each b(i, _, _) being solved.
+   * @param n The dimension of the system
+   */
+  template <MemoryArray B, typename F>
+  void rhs_dispatch(B &&b, long n, F const &solver) {
+    using B_t = std::decay_t<B>;
+    using T   = get_value_t<B_t>;
+    static_assert(get_rank<B_t> >= 1 and get_rank<B_t> <= 3, "The right hand side must be of rank 1, 2 or 3");
+
+    // Solve for a matrix, using the scratch matrix if b is not lapack compatible
+    auto solve_matrix = [&solver](auto &&bm, matrix<T, F_layout> &scratch) {
+      if constexpr (std::decay_t<decltype(bm)>::is_stride_order_Fortran()) {
+        if (bm.indexmap().min_stride() == 1) {
+          solver(bm.data(), bm.extent(1), blas::get_ld(bm));
+          return;
+        }
+      }
+      scratch = bm;
+      solver(scratch.data(), scratch.extent(1), blas::get_ld(scratch));
+      bm = scratch;
+    };
+
+    if constexpr (get_rank<B_t> == 1) {
+      EXPECTS(b.extent(0) == n);
+      if (b.indexmap().min_stride() == 1) {
+        solver(b.data(), 1, std::max(n, 1l));
+      } else {
+        array<T, 1> tmp{b};
+        solver(tmp.data(), 1, std::max(n, 1l));
+        b = tmp;
+      }
+    } else if constexpr (get_rank<B_t> == 2) {
+      EXPECTS(b.extent(0) == n);
+      matrix<T, F_layout> scratch;
+      solve_matrix(b, scratch);
+    } else {
+      EXPECTS(b.extent(1) == n);
+      // The scratch matrix is shared by all the elements of the batch
+      matrix<T, F_layout> scratch;
+      for (long i = 0; i < b.extent(0); ++i) solve_matrix(b(i, range::all, range::all), scratch);
+    }
+  }
+
+} // namespace nda::linalg::details
@@ -0,0 +1,163 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include "./cholesky_factorization.hpp"
+#include "./lu_factorization.hpp"
+#include "./rhs_dispatch.hpp"
+#include "./triangular.hpp"
+
+namespace nda::linalg {
+
+  /// The lapack path used by solve to solve A * X = B
+  enum class solve_strategy {
+    automatic,        ///< Detect the structure of A, cf. detect_solve_strategy
+    general,          ///< LU factorization (getrf/getrs)
+    upper_triangular, ///< Substitution with the upper triangle of A (trsv/trsm)
+    lower_triangular, ///< Substitution with the lower triangle of A (trsv/trsm)
+    tridiagonal,      ///< Tridiagonal solve in O(N) (gtsv), from the 3 central diagonals of A
+    positive_definite ///< Cholesky factorization (potrf/potrs) using the upper triangle of A, falling back to LU if A is not positive definite
+  };
+
+  /**
+   * Detect the cheapest lapack path to solve A * X = B, by inspection of the elements of A, in at most O(N^2) operations.
+   *
+   * In order of preference : triangular, tridiagonal (N > 2), hermitian (symmetric) with a positive diagonal,
+   * a candidate for the Cholesky factorization, and general.
+   * The tests are exact : the elements must be exactly zero, or exactly equal to the conjugate of their transpose.
+   *
+   * @param a The square matrix
+   * @return The detected strategy (never solve_strategy::automatic)
+   */
+  template <ArrayOfRank<2> A>
+  solve_strategy detect_solve_strategy(A const &a) {
+    using T = get_value_t<A>;
+    EXPECTS(is_matrix_square(a, true));
+    long n           = a.shape()[0];
+    bool upper       = true;
+    bool lower       = true;
+    bool tridiagonal = (n > 2);
+    bool hermitian   = true;
+    for (long i = 0; i < n and (upper or lower or tridiagonal or hermitian); ++i) {
+      auto aii = a(i, i);
+      if constexpr (is_complex_v<T>)
+        hermitian = hermitian and (aii.imag() == 0) and (aii.real() > 0);
+      else
+        hermitian = hermitian and (aii > 0);
+      for (long j = 0; j < i; ++j) {
+        auto aij = a(i, j), aji = a(j, i);
+        upper       = upper and (aij == T{0});
+        lower       = lower and (aji == T{0});
+        tridiagonal = tridiagonal and (i - j == 1 or (aij == T{0} and aji == T{0}));
+        hermitian   = hermitian and (aij == conj(aji));
+      }
+    }
+    if (upper) return solve_strategy::upper_triangular;
+    if (lower) return solve_strategy::lower_triangular;
+    if (tridiagonal) return solve_strategy::tridiagonal;
+    if (hermitian) return solve_strategy::positive_definite;
+    return solve_strategy::general;
+  }
+
+  /**
+   * Solve A * X = B in place, B being overwritten by X, with the cheapest lapack path for the structure of A.
+   *
+   * Unlike inverse(A) * B, the matrix is factorized (or substituted directly if triangular), which is faster and more accurate.
+   *
+   * @param a The square matrix, a view or a lazy expression. It is not modified.
+   * @param b A vector or a matrix (one right hand side per column).
+   *          Operands which are not lapack compatible are solved through a Fortran ordered copy.
+   * @param strategy The lapack path to use. By default, it is detected from the elements of A (cf. detect_solve_strategy).
+   *        A hint skips the detection : the elements of A outside of the structure are then not referenced.
+   */
+  template <ArrayOfRank<2> A, MemoryArray B>
+  void solve_in_place(A const &a, B &&b, solve_strategy strategy = solve_strategy::automatic) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "solve_in_place : element type must be a blas/lapack type");
+    static_assert(get_rank<B> == 1 or get_rank<B> == 2, "solve_in_place : b must be a vector or a matrix");
+    static_assert(std::is_same_v<get_value_t<B>, T>, "solve_in_place : b must have the element type of the matrix");
+    EXPECTS(is_matrix_square(a, true));
+    EXPECTS_WITH_MESSAGE(b.shape()[0] == a.shape()[0], "solve_in_place : dimension mismatch");
+    long n = a.shape()[0];
+    if (b.size() == 0) return;
+
+    if (strategy == solve_strategy::automatic) strategy = detect_solve_strategy(a);
+
+    switch (strategy) {
+      case solve_strategy::upper_triangular:
+      case solve_strategy::lower_triangular: {
+        auto solve_triangle = [&](auto const &m) {
+          auto v = m();
+          if (strategy == solve_strategy::upper_triangular)
+            solve_in_place(triangular_view<'U', decltype(v)>{v}, b);
+          else
+            solve_in_place(triangular_view<'L', decltype(v)>{v}, b);
+        };
+        if constexpr (MemoryArray<A>) {
+          if (a.indexmap().min_stride() == 1) {
+            solve_triangle(a);
+            return;
+          }
+        }
+        solve_triangle(matrix<T, F_layout>{a});
+        return;
+      }
+      case solve_strategy::tridiagonal: {
+        // gtsv overwrites the diagonals : they are copied for each call
+        auto dl = array<T, 1>(std::max(n - 1, 0l)), d = array<T, 1>(n), du = array<T, 1>(std::max(n - 1, 0l));
+        details::rhs_dispatch(b, n, [&](T *b_ptr, int nrhs, int ldb) {
+          for (long i = 0; i < n; ++i) d(i) = a(i, i);
+          for (long i = 0; i < n - 1; ++i) {
+            dl(i) = a(i + 1, i);
+            du(i) = a(i, i + 1);
+          }
+          int info = 0;
+          lapack::f77::gtsv(n, nrhs, dl.data(), d.data(), du.data(), b_ptr, ldb, info);
+          if (info != 0) NDA_RUNTIME_ERROR << "Error in solve : the tridiagonal matrix is singular. gtsv info = " << info;
+        });
+        return;
+      }
+      case solve_strategy::positive_definite: {
+        auto chol = cholesky_factorization<T>{a};
+        if (chol.is_positive_definite()) {
+          chol.solve_in_place(b);
+          return;
+        }
+        break; // not positive definite : LU
+      }
+      default: break;
+    }
+    lu_factorization<T>{a}.solve_in_place(b);
+  }
+
+  /**
+   * Solve A * X = B with the cheapest lapack path for the structure of A, cf. solve_in_place.
+   *
+   * @param a The square matrix, a view or a lazy expression
+   * @param b A vector or a matrix (one right hand side per column)
+   * @param strategy The lapack path to use. By default, it is detected from the elements of A.
+   * @return The solution X, with the shape of b
+   */
+  template <ArrayOfRank<2> A, Array B>
+  auto solve(A const &a, B const &b, solve_strategy strategy = solve_strategy::automatic) {
+    // For matrices, use Fortran order directly to avoid a copy in and out of lapack
+    auto x = basic_array<get_value_t<B>, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+    solve_in_place(a, x, strategy);
+    return x;
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,58 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include <tuple>
+
+#include "../lapack.hpp"
+
+namespace nda::linalg {
+
+  /**
+   * Singular value decomposition A = U * diag(S) * VT, with the divide and conquer algorithm (lapack gesdd).
+   *
+   * @param a A matrix of shape (M, N), a view or a lazy expression (copied)
+   * @param full_matrices If false (default), the thin SVD : U is (M, K) and VT is (K, N), K = min(M, N).
+   *        If true, U is (M, M) and VT is (N, N).
+   * @return Tuple (U, S, VT), the singular values S being in descending order
+   */
+  template <ArrayOfRank<2> A>
+  auto svd(A const &a, bool full_matrices = false) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "svd : element type must be a blas/lapack type");
+    auto a_copy = matrix<T, F_layout>{a};
+    auto u      = matrix<T, F_layout>{};
+    auto vt     = matrix<T, F_layout>{};
+    auto s      = array<blas::real_value_t<T>, 1>{};
+    lapack::gesdd(a_copy, s, u, vt, (full_matrices ? 'A' : 'S'));
+    return std::make_tuple(std::move(u), std::move(s), std::move(vt));
+  }
+
+  /**
+   * Singular values of a matrix, in descending order, without computing the singular vectors (lapack gesdd)
+   * @param a A matrix, a view or a lazy expression (copied)
+   */
+  template <ArrayOfRank<2> A>
+  auto singular_values(A const &a) {
+    using T = get_value_t<A>;
+    static_assert(blas::is_blas_lapack_v<T>, "singular_values : element type must be a blas/lapack type");
+    auto a_copy = matrix<T, F_layout>{a};
+    auto s      = array<blas::real_value_t<T>, 1>{};
+    lapack::gesdd(a_copy, s, matrix<T, F_layout>{}, matrix<T, F_layout>{}, 'N');
+    return s;
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,212 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#pragma once
+
+#include "../blas/trmm.hpp"
+#include "../blas/trsm.hpp"
+#include "../layout_transforms.hpp"
+
+namespace nda {
+
+  /**
+   * View of the upper (Uplo = 'U') or lower (Uplo = 'L') triangle of an existing square matrix,
+   * optionally with a unit diagonal, in which case the diagonal of the matrix is not referenced.
+   *
+   * The elements outside of the triangle are never read : they are zero for the view.
+   * Products (blas trmv/trmm) and linear solves (blas trsv/trsm) use only the triangle,
+   * at half the cost of the dense gemm and of the LU solve.
+   *
+   * @tparam Uplo 'U' or 'L'
+   * @tparam M The type of the view of the underlying matrix (unit smallest stride, C or Fortran order)
+   */
+  template <char Uplo, typename M>
+  class triangular_view {
+    static_assert(Uplo == 'U' or Uplo == 'L', "triangular_view : Uplo must be 'U' or 'L'");
+    static_assert(is_regular_or_view_v<M> and get_rank<M> == 2, "triangular_view : M must be a matrix view");
+
+    M _m;
+    bool _unit_diag = false;
+
+    public:
+    using value_type = std::remove_const_t<typename M::value_type>;
+    static_assert(blas::is_blas_lapack_v<value_type>, "triangular_view : element type must be a blas/lapack type");
+
+    /// The upper ('U') or lower ('L') triangle
+    static constexpr char uplo = Uplo;
+
+    /**
+     * @param m View of the underlying matrix
+     * @param unit_diag If true, the diagonal is assumed to be 1 and is not referenced
+     */
+    explicit triangular_view(M m, bool unit_diag = false) : _m(std::move(m)), _unit_diag(unit_diag) {
+      EXPECTS(is_matrix_square(_m, true));
+      EXPECTS_WITH_MESSAGE(_m.indexmap().min_stride() == 1, "triangular_view : the matrix must have a unit smallest stride");
+    }
+
+    /// The underlying matrix (both triangles)
+    [[nodiscard]] M const &matrix() const { return _m; }
+
+    /// Is the diagonal assumed to be 1 ?
+    [[nodiscard]] bool unit_diagonal() const { return _unit_diag; }
+
+    /// The diag argument of the blas triangular routines
+    [[nodiscard]] char diag() const { return (_unit_diag ? 'U' : 'N'); }
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const { return _m.extent(0); }
+
+    /// Shape of the matrix
+    [[nodiscard]] std::array<long, 2> shape() const { return _m.shape(); }
+
+    /// Is (i, j) in the triangle (diagonal included) ?
+    [[nodiscard]] static bool in_triangle(long i, long j) { return (Uplo == 'U' ? i <= j : i >= j); }
+
+    /// The element (i, j), for any i, j
+    [[nodiscard]] value_type operator()(long i, long j) const {
+      if (i == j and _unit_diag) return value_type{1};
+      return (in_triangle(i, j) ? value_type{_m(i, j)} : value_type{0});
+    }
+
+    /// The full dense matrix, with zeros outside of the triangle
+    [[nodiscard]] nda::matrix<value_type> to_dense() const {
+      auto r = nda::matrix<value_type>(dim(), dim());
+      for (long i = 0; i < dim(); ++i)
+        for (long j = 0; j < dim(); ++j) r(i, j) = (*this)(i, j);
+      return r;
+    }
+
+    /// The transposed matrix, a view of the opposite triangle of the transposed underlying matrix (no copy)
+    friend auto transpose(triangular_view const &t) {
+      auto mt = nda::transpose(t._m);
+      return triangular_view<(Uplo == 'U' ? 'L' : 'U'), decltype(mt)>{mt, t._unit_diag};
+    }
+
+    /// Product with a vector (blas trmv) or with a matrix (blas trmm)
+    template <Array X>
+    friend auto operator*(triangular_view const &a, X const &x) {
+      static_assert(get_rank<X> == 1 or get_rank<X> == 2, "triangular_view * x : x must be a vector or a matrix");
+      static_assert(std::is_same_v<get_value_t<X>, value_type>, "triangular_view * x : x must have the element type of the matrix");
+      EXPECTS_WITH_MESSAGE(x.shape()[0] == a.dim(), "triangular_view * x : dimension mismatch");
+      if constexpr (get_rank<X> == 1) {
+        auto r = vector<value_type>{x};
+        if (a.dim() > 0) blas::trmv(a._m, r, Uplo, a.diag());
+        return r;
+      } else {
+        auto r = nda::matrix<value_type, F_layout>{x};
+        if (r.size() > 0) blas::trmm(value_type{1}, a._m, r, Uplo, a.diag());
+        return r;
+      }
+    }
+
+    /// Product of a matrix with the triangular matrix on the right (blas trmm)
+    template <ArrayOfRank<2> X>
+    friend auto operator*(X const &x, triangular_view const &a) {
+      static_assert(std::is_same_v<get_value_t<X>, value_type>, "x * triangular_view : x must have the element type of the matrix");
+      EXPECTS_WITH_MESSAGE(x.shape()[1] == a.dim(), "x * triangular_view : dimension mismatch");
+      auto r = nda::matrix<value_type, F_layout>{x};
+      if (r.size() > 0) blas::trmm(value_type{1}, a._m, r, Uplo, a.diag(), 'R');
+      return r;
+    }
+  };
+
+  /// Is T a triangular_view ?
+  template <typename T>
+  inline constexpr bool is_triangular_view_v = false;
+
+  template <char Uplo, typename M>
+  inline constexpr bool is_triangular_view_v<triangular_view<Uplo, M>> = true;
+
+  namespace details {
+    template <char Uplo, typename A>
+    auto make_triangular_view(A &&a, bool unit_diag) {
+      static_assert(not is_regular_v<std::decay_t<A>> or std::is_lvalue_reference_v<A>,
+                    "triangular_view : the view of a temporary matrix would dangle. Store the matrix first.");
+      auto v = a();
+      return triangular_view<Uplo, decltype(v)>{v, unit_diag};
+    }
+  } // namespace details
+
+  /**
+   * View of the upper triangle of a square matrix
+   * @param a A matrix or a matrix view (not copied)
+   * @param unit_diag If true, the diagonal is assumed to be 1 and is not referenced
+   */
+  template <MemoryArrayOfRank<2> A>
+  auto upper_triangular(A &&a, bool unit_diag = false) {
+    return details::make_triangular_view<'U'>(std::forward<A>(a), unit_diag);
+  }
+
+  /**
+   * View of the lower triangle of a square matrix
+   * @param a A matrix or a matrix view (not copied)
+   * @param unit_diag If true, the diagonal is assumed to be 1 and is not referenced
+   */
+  template <MemoryArrayOfRank<2> A>
+  auto lower_triangular(A &&a, bool unit_diag = false) {
+    return details::make_triangular_view<'L'>(std::forward<A>(a), unit_diag);
+  }
+
+} // namespace nda
+
+namespace nda::linalg {
+
+  /**
+   * Solve A * X = B in place for a triangular A, by substitution (blas trsv/trsm), B being overwritten by X.
+   *
+   * @param a The triangular matrix. An exactly singular matrix (zero on the diagonal) is an error.
+   * @param b A vector or a matrix (one right hand side per column).
+   *          Operands which are not blas compatible are solved through a copy.
+   */
+  template <char Uplo, typename M, MemoryArray B>
+  void solve_in_place(triangular_view<Uplo, M> const &a, B &&b) {
+    using T = typename triangular_view<Uplo, M>::value_type;
+    static_assert(get_rank<B> == 1 or get_rank<B> == 2, "solve_in_place : b must be a vector or a matrix");
+    static_assert(std::is_same_v<get_value_t<B>, T>, "solve_in_place : b must have the element type of the matrix");
+    EXPECTS_WITH_MESSAGE(b.shape()[0] == a.dim(), "solve_in_place : dimension mismatch");
+    if (b.size() == 0) return;
+    if (not a.unit_diagonal())
+      for (long i = 0; i < a.dim(); ++i)
+        if (a.matrix()(i, i) == T{0}) NDA_RUNTIME_ERROR << "Error in solve : the triangular matrix is singular. Zero diagonal element " << i;
+
+    if constexpr (get_rank<B> == 1) {
+      blas::trsv(a.matrix(), b, Uplo, a.diag());
+    } else {
+      if (b.indexmap().min_stride() == 1) {
+        blas::trsm(T{1}, a.matrix(), b, Uplo, a.diag());
+      } else {
+        auto x = matrix<T, F_layout>{b};
+        blas::trsm(T{1}, a.matrix(), x, Uplo, a.diag());
+        b = x;
+      }
+    }
+  }
+
+  /**
+   * Solve A * X = B for a triangular A, by substitution (blas trsv/trsm)
+   *
+   * @param a The triangular matrix
+   * @param b A vector or a matrix (one right hand side per column)
+   * @return The solution X, with the shape of b
+   */
+  template <char Uplo, typename M, Array B>
+  auto solve(triangular_view<Uplo, M> const &a, B const &b) {
+    // For matrices, use Fortran order directly
+    auto x = basic_array<get_value_t<B>, get_rank<B>, std::conditional_t<get_rank<B> == 2, F_layout, C_layout>, get_algebra<B>, heap>{b};
+    solve_in_place(a, x);
+    return x;
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,408 @@
+// Copyright (c) 2019-2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <numeric>
+
+#include "../linalg/matmul.hpp"
+
+namespace nda::sparse {
+
+  namespace details {
+
+    // Below this number of non zero elements, the products are not worth distributing over threads
+    constexpr long spmv_parallel_threshold = 1 << 15;
+
+    // Element of op(A) for op = 'N', 'T' or 'C'
+    template <typename T>
+    T apply_op(T const &x, char op) {
+      if constexpr (is_complex_v<T>)
+        return (op == 'C' ? std::conj(x) : x);
+      else
+        return x;
+    }
+
+  } // namespace details
+
+  /**
+   * Sparse matrix in the compressed sparse row (CSR) format.
+   *
+   * The non zero elements of row i are values()(k), in the columns col_idx()(k), for row_ptr()(i) <= k < row_ptr()(i + 1).
+   * The column indices are sorted within each row, and unique.
+   *
+   * A CSC matrix is the CSR matrix of its transpose : use transpose() or the op = 'T' argument of the products.
+   *
+   * The matrix interoperates with nda vectors and matrices through spmv, spmm, matvecmul, matmul and operator*.
+   * It is deliberately not an nda Array : it does not provide elementwise access, nor take part in lazy expressions.
+   *
+   * @tparam T Element type
+   * @tparam Index Integer type of the column indices and row pointers (e.g. int to save memory on large matrices)
+   */
+  template <typename T, std::integral Index = long>
+  class csr_matrix {
+    long _n_rows = 0;
+    long _n_cols = 0;
+    array<T, 1> _values;
+    array<Index, 1> _col_idx;
+    array<Index, 1> _row_ptr = array<Index, 1>(1, Index{0});
+
+    // Check the invariants of the CSR format
+    void _check() const {
+      EXPECTS_WITH_MESSAGE(_row_ptr.size() == _n_rows + 1, "csr_matrix : row_ptr must have n_rows + 1 elements");
+      EXPECTS_WITH_MESSAGE(_values.size() == _col_idx.size(), "csr_matrix : values and col_idx must have the same size");
+      EXPECTS_WITH_MESSAGE(_row_ptr(0) == 0 and _row_ptr(_n_rows) == _values.size(), "csr_matrix : row_ptr must start at 0 and end at nnz");
+      for (long i = 0; i < _n_rows; ++i) {
+        EXPECTS_WITH_MESSAGE(_row_ptr(i) <= _row_ptr(i + 1), "csr_matrix : row_ptr must be non decreasing");
+        for (long k = _row_ptr(i); k < _row_ptr(i + 1); ++k) {
+          EXPECTS_WITH_MESSAGE(_col_idx(k) >= 0 and _col_idx(k) < _n_cols, "csr_matrix : column index out of range in row " << i);
+          EXPECTS_WITH_MESSAGE(k == _row_ptr(i) or _col_idx(k - 1) < _col_idx(k), "csr_matrix : unsorted or duplicate column index in row " << i);
+        }
+      }
+    }
+
+    public:
+    using value_type = T;
+    using index_type = Index;
+
+    /// An empty 0 x 0 matrix
+    csr_matrix() = default;
+
+    /// The zero matrix of size n_rows x n_cols
+    csr_matrix(long n_rows, long n_cols) : _n_rows(n_rows), _n_cols(n_cols), _row_ptr(n_rows + 1) { _row_ptr = 0; }
+
+    /**
+     * Construct from the CSR arrays, taking ownership of their storage.
+     * The arrays are checked for consistency (sorted and unique column indices in each row).
+     */
+    csr_matrix(long n_rows, long n_cols, array<T, 1> values, array<Index, 1> col_idx, array<Index, 1> row_ptr)
+       : _n_rows(n_rows), _n_cols(n_cols), _values(std::move(values)), _col_idx(std::move(col_idx)), _row_ptr(std::move(row_ptr)) {
+      _check();
+    }
+
+    /**
+     * Construct from a dense matrix, keeping its non zero elements.
+     *
+     * @param m A matrix or a rank 2 array
+     * @param tol Elements with abs(m(i,j)) <= tol are dropped
+     */
+    template <ArrayOfRank<2> M>
+    explicit csr_matrix(M const &m, double tol = 0) : _n_rows(m.shape()[0]), _n_cols(m.shape()[1]), _row_ptr(m.shape()[0] + 1) {
+      auto keep = [&m, tol](long i, long j) { return std::abs(m(i, j)) > tol; };
+      _row_ptr(0) = 0;
+      for (long i = 0; i < _n_rows; ++i) {
+        long n = 0;
+        for (long j = 0; j < _n_cols; ++j) n += keep(i, j);
+        _row_ptr(i + 1) = _row_ptr(i) + n;
+      }
+      _values.resize(_row_ptr(_n_rows));
+      _col_idx.resize(_row_ptr(_n_rows));
+      for (long i = 0, k = 0; i < _n_rows; ++i)
+        for (long j = 0; j < _n_cols; ++j)
+          if (keep(i, j)) {
+            _values(k)  = m(i, j);
+            _col_idx(k) = j;
+            ++k;
+          }
+    }
+
+    /**
+     * Construct from the coordinate (COO) format, i.e. a list of triplets (rows(k), cols(k), values(k)).
+     *
+     * The triplets can be given in any order. Duplicate entries are summed.
+     * The construction is a bucket sort by row, followed by a sort of the columns within each row : O(nnz log(nnz / n_rows)).
+     *
+     * @param n_rows Number of rows
+     * @param n_cols Number of columns
+     * @param rows Row indices of the triplets
+     * @param cols Column indices of the triplets
+     * @param values Values of the triplets
+     */
+    template <ArrayOfRank<1> R, ArrayOfRank<1> C, ArrayOfRank<1> V>
+    static csr_matrix from_coo(long n_rows, long n_cols, R const &rows, C const &cols, V const &values) {
+      long n = values.size();
+      EXPECTS_WITH_MESSAGE(rows.size() == n and cols.size() == n, "csr_matrix::from_coo : rows, cols and values must have the same size");
+
+      // Bucket sort of the triplets by row
+      auto row_ptr = array<Index, 1>(n_rows + 1);
+      row_ptr      = 0;
+      for (long k = 0; k < n; ++k) {
+        EXPECTS_WITH_MESSAGE(rows(k) >= 0 and rows(k) < n_rows and cols(k) >= 0 and cols(k) < n_cols,
+                             "csr_matrix::from_coo : index (" << rows(k) << ", " << cols(k) << ") out of range");
+        ++row_ptr(rows(k) + 1);
+      }
+      for (long i = 0; i < n_rows; ++i) row_ptr(i + 1) += row_ptr(i);
+
+      auto perm = array<long, 1>(n);
+      auto next = array<Index, 1>{row_ptr(range(0, n_rows))};
+      for (long k = 0; k < n; ++k) perm(next(rows(k))++) = k;
+
+      // Sort each row by column, and sum the duplicates
+      auto r = csr_matrix{};
+      r._n_rows = n_rows;
+      r._n_cols = n_cols;
+      r._values.resize(n);
+      r._col_idx.resize(n);
+      r._row_ptr.resize(n_rows + 1);
+      r._row_ptr(0) = 0;
+      long nnz      = 0;
+      for (long i = 0; i < n_rows; ++i) {
+        std::sort(perm.data() + row_ptr(i), perm.data() + row_ptr(i + 1), [&cols](long k1, long k2) { return cols(k1) < cols(k2); });
+        for (long p = row_ptr(i); p < row_ptr(i + 1); ++p) {
+          long k = perm(p);
+          if (nnz > r._row_ptr(i) and r._col_idx(nnz - 1) == cols(k)) {
+            r._values(nnz - 1) += values(k);
+          } else {
+            r._values(nnz)  = values(k);
+            r._col_idx(nnz) = cols(k);
+            ++nnz;
+          }
+        }
+        r._row_ptr(i + 1) = nnz;
+      }
+      if (nnz < n) {
+        r._values  = array<T, 1>{r._values(range(0, nnz))};
+        r._col_idx = array<Index, 1>{r._col_idx(range(0, nnz))};
+      }
+      return r;
+    }
+
+    /// Shape of the matrix
+    [[nodiscard]] std::array<long, 2> shape() const { return {_n_rows, _n_cols}; }
+
+    /// Extent of the matrix along dimension i
+    [[nodiscard]] long extent(int i) const { return (i == 0 ? _n_rows : _n_cols); }
+
+    /// Number of stored (structurally non zero) elements
+    [[nodiscard]] long nnz() const { return _values.size(); }
+
+    /// The stored elements, row by row
+    [[nodiscard]] array<T, 1> const &values() const { return _values; }
+
+    /// The stored elements, row by row. The sparsity pattern can not be changed, but the values can.
+    [[nodiscard]] array_view<T, 1> values() { return _values; }
+
+    /// The column index of each stored element
+    [[nodiscard]] array<Index, 1> const &col_idx() const { return _col_idx; }
+
+    /// The stored elements of row i are in [row_ptr()(i), row_ptr()(i + 1))
+    [[nodiscard]] array<Index, 1> const &row_ptr() const { return _row_ptr; }
+
+    /// The dense matrix
+    [[nodiscard]] matrix<T> to_dense() const {
+      auto r = matrix<T>::zeros(shape());
+      for (long i = 0; i < _n_rows; ++i)
+        for (long k = _row_ptr(i); k < _row_ptr(i + 1); ++k) r(i, _col_idx(k)) = _values(k);
+      return r;
+    }
+
+    /**
+     * The transposed matrix, in CSR format (i.e. this matrix in CSC format).
+     * Computed in O(nnz + n_cols) by a bucket sort on the columns, which keeps the columns of the result sorted.
+     */
+    [[nodiscard]] csr_matrix transpose() const {
+      auto r = csr_matrix{};
+      r._n_rows = _n_cols;
+      r._n_cols = _n_rows;
+      r._values.resize(nnz());
+      r._col_idx.resize(nnz());
+      r._row_ptr.resize(_n_cols + 1);
+      r._row_ptr = 0;
+      for (long k = 0; k < nnz(); ++k) ++r._row_ptr(_col_idx(k) + 1);
+      for (long j = 0; j < _n_cols; ++j) r._row_ptr(j + 1) += r._row_ptr(j);
+
+      auto next = array<Index, 1>{r._row_ptr(range(0, _n_cols))};
+      for (long i = 0; i < _n_rows; ++i)
+        for (long k = _row_ptr(i); k < _row_ptr(i + 1); ++k) {
+          long p        = next(_col_idx(k))++;
+          r._values(p)  = _values(k);
+          r._col_idx(p) = i;
+        }
+      return r;
+    }
+  };
+
+  /// Deduction guide : construct from a dense matrix
+  template <ArrayOfRank<2> M>
+  csr_matrix(M const &, double = 0) -> csr_matrix<get_value_t<M>>;
+
+  // -------------------------------------------------------------------------------------
+
+  /// Is T a csr_matrix ?
+  template <typename T>
+  inline constexpr bool is_csr_matrix_v = false;
+
+  template <typename T, typename Index>
+  inline constexpr bool is_csr_matrix_v<csr_matrix<T, Index>> = true;
+
+  // -------------------------------------------------------------------------------------
+
+  /**
+   * Sparse matrix vector product y = alpha * op(A) * x + beta * y, with op(A) = A, A^T or A^H.
+   *
+   * For op = 'N', the rows are distributed over the OpenMP threads (when compiled with OpenMP).
+   * For op = 'T' or 'C', the product is a serial scatter over the rows of A, which avoids building the transpose.
+   * If beta == 0, y is not read.
+   *
+   * @param alpha
+   * @param a The sparse matrix
+   * @param x A vector, a view or a lazy expression
+   * @param beta
+   * @param y The result. Can be a temporary view (hence the &&). It must not alias x.
+   * @param op 'N', 'T' or 'C'
+   */
+  template <typename T, typename Index, ArrayOfRank<1> X, blas::VectorView Y>
+  void spmv(get_value_t<Y> const &alpha, csr_matrix<T, Index> const &a, X const &x, get_value_t<Y> const &beta, Y &&y, char op = 'N') {
+    using V = get_value_t<Y>;
+    EXPECTS_WITH_MESSAGE(op == 'N' or op == 'T' or op == 'C', "spmv : op must be 'N', 'T' or 'C'");
+    bool trans = (op != 'N');
+    EXPECTS_WITH_MESSAGE(x.size() == a.extent(trans ? 0 : 1) and y.size() == a.extent(trans ? 1 : 0), "spmv : dimension mismatch");
+
+    auto *rp  = a.row_ptr().data();
+    auto *ci  = a.col_idx().data();
+    auto *val = a.values().data();
+    long n    = a.extent(0);
+
+    if (not trans) {
+#ifdef _OPENMP
+#pragma omp parallel for if (a.nnz() > details::spmv_parallel_threshold)
+#endif
+      for (long i = 0; i < n; ++i) {
+        V s{0};
+        for (auto k = rp[i]; k < rp[i + 1]; ++k) s += val[k] * x(ci[k]);
+        y(i) = (beta == V{0} ? alpha * s : alpha * s + beta * y(i));
+      }
+    } else {
+      if (beta == V{0})
+        y = 0;
+      else if (beta != V{1})
+        y *= beta;
+      for (long i = 0; i < n; ++i) {
+        V ax = alpha * x(i);
+        for (auto k = rp[i]; k < rp[i + 1]; ++k) y(ci[k]) += details::apply_op(val[k], op) * ax;
+      }
+    }
+  }
+
+  /**
+   * Sparse matrix dense matrix product y = alpha * op(A) * x + beta * y, with op(A) = A, A^T or A^H.
+   *
+   * Same as spmv, for x and y matrices (one vector per column).
+   * The products are faster when x and y are in C order, the inner loop running over their rows.
+   *
+   * @param alpha
+   * @param a The sparse matrix
+   * @param x A matrix, a view or a lazy expression
+   * @param beta
+   * @param y The result. Can be a temporary view (hence the &&). It must not alias x.
+   * @param op 'N', 'T' or 'C'
+   */
+  template <typename T, typename Index, ArrayOfRank<2> X, blas::MatrixView Y>
+  void spmm(get_value_t<Y> const &alpha, csr_matrix<T, Index> const &a, X const &x, get_value_t<Y> const &beta, Y &&y, char op = 'N') {
+    using V = get_value_t<Y>;
+    EXPECTS_WITH_MESSAGE(op == 'N' or op == 'T' or op == 'C', "spmm : op must be 'N', 'T' or 'C'");
+    bool trans = (op != 'N');
+    EXPECTS_WITH_MESSAGE(x.shape()[0] == a.extent(trans ? 0 : 1) and y.extent(0) == a.extent(trans ? 1 : 0) and y.extent(1) == x.shape()[1],
+                         "spmm : dimension mismatch");
+
+    auto *rp  = a.row_ptr().data();
+    auto *ci  = a.col_idx().data();
+    auto *val = a.values().data();
+    long n    = a.extent(0);
+    long m    = x.shape()[1];
+
+    if (beta == V{0})
+      y = 0;
+    else if (beta != V{1})
+      y *= beta;
+
+    if (not trans) {
+#ifdef _OPENMP
+#pragma omp parallel for if (a.nnz() * m > details::spmv_parallel_threshold)
+#endif
+      for (long i = 0; i < n; ++i)
+        for (auto k = rp[i]; k < rp[i + 1]; ++k) {
+          V av = alpha * val[k];
+          for (long j = 0; j < m; ++j) y(i, j) += av * x(ci[k], j);
+        }
+    } else {
+      for (long i = 0; i < n; ++i)
+        for (auto k = rp[i]; k < rp[i + 1]; ++k) {
+          V av = alpha * details::apply_op(val[k], op);
+          for (long j = 0; j < m; ++j) y(ci[k], j) += av * x(i, j);
+        }
+    }
+  }
+
+  /// Sparse matrix * vector or sparse matrix * dense matrix, cf. matvecmul and matmul
+  template <typename T, typename Index, Array X>
+  auto operator*(csr_matrix<T, Index> const &a, X const &x) {
+    static_assert(get_rank<X> == 1 or get_rank<X> == 2, "csr_matrix * x : x must be a vector or a matrix");
+    if constexpr (get_rank<X> == 1)
+      return matvecmul(a, x);
+    else
+      return matmul(a, x);
+  }
+
+} // namespace nda::sparse
+
+namespace nda {
+
+  /**
+   * Sparse matrix vector product out = a * x, reusing the storage of out.
+   * Overload of matvecmul_into for a csr_matrix, so that generic code written with matvecmul_into runs unchanged.
+   */
+  template <blas::VectorView Out, typename L, typename R>
+    requires(sparse::is_csr_matrix_v<L>)
+  void matvecmul_into(Out &&out, L const &l, R const &r) {
+    details::resize_or_check(out, std::array<long, 1>{l.extent(0)});
+    sparse::spmv(1, l, r, 0, out);
+  }
+
+  /// Sparse matrix vector product a * x, cf. matvecmul
+  template <typename L, typename R>
+    requires(sparse::is_csr_matrix_v<std::decay_t<L>>)
+  auto matvecmul(L &&l, R &&r) {
+    using promoted_type = decltype(typename std::decay_t<L>::value_type{} * get_value_t<std::decay_t<R>>{});
+    array<promoted_type, 1> result(l.extent(0));
+    matvecmul_into(result, l, r);
+    return result;
+  }
+
+  /**
+   * Sparse matrix dense matrix product out = a * x, reusing the storage of out.
+   * Overload of matmul_into for a csr_matrix.
+   */
+  template <blas::MatrixView Out, typename L, typename R>
+    requires(sparse::is_csr_matrix_v<L>)
+  void matmul_into(Out &&out, L const &l, R const &r) {
+    details::resize_or_check(out, std::array<long, 2>{l.extent(0), r.shape()[1]});
+    sparse::spmm(1, l, r, 0, out);
+  }
+
+  /// Sparse matrix dense matrix product a * x, cf. matmul. The result is in C order, the optimal layout for spmm.
+  template <typename L, typename R>
+    requires(sparse::is_csr_matrix_v<std::decay_t<L>>)
+  auto matmul(L &&l, R &&r) {
+    using promoted_type = decltype(typename std::decay_t<L>::value_type{} * get_value_t<std::decay_t<R>>{});
+    matrix<promoted_type> result(l.extent(0), r.shape()[1]);
+    matmul_into(result, l, r);
+    return result;
+  }
+
+} // namespace nda
@@ -0,0 +1,104 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// The band of a diagonally dominant dense test matrix, with kl sub-diagonals and ku super-diagonals
+template <typename T>
+nda::matrix<T> make_banded(long n, long kl, long ku) {
+  return nda::band_matrix<T>{make_test_matrix<T>(n, n, 2.0 * (1 + kl + ku)), kl, ku}.to_dense();
+}
+
+// ==============================================================
+
+template <typename T>
+void test_band(long n, long kl, long ku) {
+  auto M = make_banded<T>(n, kl, ku);
+  auto A = nda::band_matrix<T>{M, kl, ku};
+
+  EXPECT_ARRAY_NEAR(A.to_dense(), M, 1.e-15);
+  EXPECT_COMPLEX_NEAR(A(0, n - 1), M(0, n - 1), 1.e-15);
+  EXPECT_EQ(A.storage().extent(0), 2 * kl + ku + 1);
+
+  // Products
+  auto x = nda::vector<T>(n);
+  for (long i = 0; i < n; ++i) x(i) = 1.0 / (i + 2);
+  EXPECT_ARRAY_NEAR(A * x, M * x, 1.e-13);
+  auto X = nda::matrix<T>(n, 3);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < 3; ++j) X(i, j) = i - 2.0 * j;
+  EXPECT_ARRAY_NEAR(A * X, M * X, 1.e-12);
+
+  // blas::gbmv transposed, with strided vectors and beta
+  auto y  = nda::vector<T>(2 * n);
+  y       = 1;
+  auto y0 = y;
+  nda::blas::gbmv(T{2}, A.band(), n, kl, ku, x, T{-1}, y(range(0, 2 * n, 2)), 'T');
+  EXPECT_ARRAY_NEAR(y(range(0, 2 * n, 2)), nda::vector<T>{2 * nda::transpose(M) * x - y0(range(0, 2 * n, 2))}, 1.e-13);
+  nda::blas::gbmv(T{1}, A.band(), n, kl, ku, x, T{0}, y(range(0, n)), 'C');
+  EXPECT_ARRAY_NEAR(y(range(0, n)), nda::vector<T>{nda::dagger(M) * x}, 1.e-13);
+
+  // Factorization and repeated solves
+  auto lu = nda::linalg::band_lu_factorization{A};
+  EXPECT_ARRAY_NEAR(lu.solve(M * x), x, 1.e-12);
+  EXPECT_ARRAY_NEAR(lu.solve(M * X), X, 1.e-12);
+  EXPECT_NEAR(std::abs(lu.determinant() / nda::determinant(M) - T{1}), 0, 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(A, M * x), x, 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(A, M * X), X, 1.e-12);
+
+  // lapack::gbsv directly on a copy of the storage
+  auto ab   = nda::matrix<T, nda::F_layout>{A.storage()};
+  auto b    = nda::matrix<T, nda::F_layout>{M * X};
+  auto ipiv = nda::array<int, 1>{};
+  EXPECT_EQ(nda::lapack::gbsv(ab, kl, ku, ipiv, b), 0);
+  EXPECT_ARRAY_NEAR(b, X, 1.e-12);
+}
+
+TEST(Band, Double) { //NOLINT
+  test_band<double>(20, 2, 3);
+  test_band<double>(15, 0, 4);
+  test_band<double>(15, 4, 0);
+}
+TEST(Band, Complex) { test_band<dcomplex>(20, 3, 2); } //NOLINT
+
+// ==============================================================
+
+TEST(Band, Tridiagonal) { //NOLINT
+  // gbsv with kl = ku = 1 agrees with gtsv
+  long n   = 10;
+  auto M   = make_banded<double>(n, 1, 1);
+  auto rhs = nda::vector<double>(n);
+  for (long i = 0; i < n; ++i) rhs(i) = std::sin(i);
+
+  nda::vector<double> dl(n - 1), d(n), du(n - 1);
+  for (long i = 0; i < n; ++i) d(i) = M(i, i);
+  for (long i = 0; i < n - 1; ++i) {
+    dl(i) = M(i + 1, i);
+    du(i) = M(i, i + 1);
+  }
+  auto x_gtsv = rhs;
+  EXPECT_EQ(nda::lapack::gtsv(dl, d, du, x_gtsv), 0);
+
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(nda::band_matrix<double>{M, 1, 1}, rhs), x_gtsv, 1.e-13);
+}
+
+TEST(Band, Singular) { //NOLINT
+  auto A  = nda::band_matrix<double>(4, 1, 1);
+  auto lu = nda::linalg::band_lu_factorization{A};
+  EXPECT_TRUE(lu.is_singular());
+  EXPECT_THROW(lu.solve(nda::vector<double>(4)), nda::runtime_error);              //NOLINT
+  EXPECT_THROW(nda::linalg::solve(A, nda::vector<double>(4)), nda::runtime_error); //NOLINT
+}
@@ -76,6 +76,35 @@ TEST(BLAS, gemmCF) { //NOLINT
   EXPECT_ARRAY_NEAR(M3, nda::matrix<dcomplex>{{1, 1}, {3, 3}});
 }
 
+//----------------------------
+TEST(BLAS, gemm_strided) { //NOLINT
+
+  // Small products are computed with gemm_generic, large ones by packing the non unit stride operands
+  for (long n : {3, 40}) {
+    auto A = nda::rand<double>(n, 2 * n);
+    auto B = nda::rand<double>(n, 2 * n);
+    auto C = nda::rand<double>(n, 2 * n);
+
+    auto every_other = nda::range(0, 2 * n, 2);
+    auto a           = A(nda::range::all, every_other);
+    auto b           = B(nda::range::all, every_other);
+    auto c           = C(nda::range::all, every_other);
+
+    nda::matrix<double> a_copy = a, b_copy = b, c_copy = c;
+    nda::matrix<double> c_exact = 2 * a_copy * b_copy + 3 * c_copy;
+    nda::matrix<double> c_other = C(nda::range::all, nda::range(1, 2 * n, 2));
+
+    nda::blas::gemm(2.0, a, b, 3.0, c);
+    EXPECT_ARRAY_NEAR(c, c_exact, 1.e-13);
+
+    // The other columns of C are untouched
+    EXPECT_EQ_ARRAY(C(nda::range::all, nda::range(1, 2 * n, 2)), c_other);
+
+    // Through matmul, and with a blas compatible output
+    EXPECT_ARRAY_NEAR(nda::matmul(a, b), nda::matrix<double>{a_copy * b_copy}, 1.e-13);
+  }
+}
+
 // ==============================================================
 
 TEST(BLAS, gemv) { //NOLINT
@@ -105,6 +134,11 @@ TEST(BLAS, gemv) { //NOLINT
   nda::blas::gemv(1, Acw(R, R), MC(R), 0, MB_w);
   EXPECT_ARRAY_NEAR(MB, nda::vector<double>{0, 9, 13, 0, 0});
 
+  // Non unit stride matrix
+  nda::range R2(0, 5, 2);
+  nda::blas::gemv(1, A(R2, R2), MC(R2), 0, MB(R2));
+  EXPECT_ARRAY_NEAR(MB, nda::vector<double>{15, 9, 21, 0, 27});
+
   // test *
   MB()  = -8;
   MB(R) = Acw(R, R) * nda::vector_view<double>{MC(R)};
@@ -120,6 +154,12 @@ TEST(BLAS, ger) { //NOLINT
 
   nda::blas::ger(1.0, V, V, M);
   EXPECT_ARRAY_NEAR(M, nda::matrix<double>{{1, 2}, {2, 4}});
+
+  // Non unit stride matrix
+  nda::matrix<double> M2(2, 4);
+  M2 = 0;
+  nda::blas::ger(1.0, V, V, M2(nda::range::all, nda::range(0, 4, 2)));
+  EXPECT_ARRAY_NEAR(M2, nda::matrix<double>{{1, 0, 2, 0}, {2, 0, 4, 0}});
 }
 
 //----------------------------
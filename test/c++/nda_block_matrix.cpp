@@ -0,0 +1,109 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// A hermitian, well conditioned block diagonal matrix
+template <typename T>
+nda::block_matrix<T> make_blocks(std::vector<long> const &sizes) {
+  auto m = nda::block_matrix<T>{sizes};
+  for (long b = 0; b < m.n_blocks(); ++b) m.block(b) = make_test_hermitian<T>(sizes[b], 4.0 + b + sizes[b], b);
+  return m;
+}
+
+// ==============================================================
+
+TEST(BlockMatrix, Construct) { //NOLINT
+  nda::matrix<double> A = {{1, 2}, {3, 4}};
+  nda::matrix<double> B = {{5}};
+  auto m                = nda::block_matrix<double>{std::vector{A, B, A}};
+
+  EXPECT_EQ(m.n_blocks(), 3);
+  EXPECT_EQ(m.dim(), 5);
+  EXPECT_EQ(m.data().size(), 9);
+  EXPECT_ARRAY_NEAR(m.block(1), B);
+
+  nda::matrix<double> D = {{1, 2, 0, 0, 0}, {3, 4, 0, 0, 0}, {0, 0, 5, 0, 0}, {0, 0, 0, 1, 2}, {0, 0, 0, 3, 4}};
+  EXPECT_ARRAY_NEAR(m.to_dense(), D);
+
+  // Back from the dense matrix, and into a view of a larger matrix
+  auto m2 = nda::block_matrix<double>{D, {2, 1, 2}};
+  EXPECT_ARRAY_NEAR(m2.to_dense(), D);
+  nda::matrix<double> big(7, 7);
+  m2.to_dense(big(range(1, 6), range(2, 7)));
+  EXPECT_ARRAY_NEAR(big(range(1, 6), range(2, 7)), D);
+  EXPECT_ARRAY_NEAR(D(m.block_range(2), m.block_range(2)), A);
+
+  // Empty blocks are allowed
+  auto m3 = nda::block_matrix<double>{std::vector<long>{2, 0, 1}};
+  EXPECT_EQ(m3.dim(), 3);
+  EXPECT_EQ(m3.block(1).size(), 0);
+}
+
+// ==============================================================
+
+template <typename T>
+void test_block_algebra(std::vector<long> const &sizes) {
+  auto x = make_blocks<T>(sizes);
+  auto y = make_blocks<T>(sizes);
+  y *= T{0.5};
+  auto X = x.to_dense();
+  auto Y = y.to_dense();
+
+  EXPECT_ARRAY_NEAR((x * y).to_dense(), X * Y, 1.e-13);
+  EXPECT_ARRAY_NEAR((x + y).to_dense(), X + Y, 1.e-13);
+  EXPECT_ARRAY_NEAR((x - 2 * y).to_dense(), X - 2 * Y, 1.e-13);
+
+  // Products with dense vectors and matrices
+  auto v = nda::vector<T>(x.dim());
+  for (long i = 0; i < x.dim(); ++i) v(i) = i - 3;
+  EXPECT_ARRAY_NEAR(x * v, X * v, 1.e-13);
+  EXPECT_ARRAY_NEAR(x * (2 * v), 2 * X * v, 1.e-13);
+  EXPECT_ARRAY_NEAR(x * Y, X * Y, 1.e-13);
+
+  // Inverse and determinant
+  EXPECT_ARRAY_NEAR(nda::inverse(x).to_dense(), nda::inverse(X), 1.e-12);
+  EXPECT_NEAR(std::abs(nda::determinant(x) / nda::determinant(X) - T{1}), 0, 1.e-12);
+
+  // Eigenelements
+  auto [ev, vecs] = nda::linalg::eigenelements(x);
+  for (long b = 0; b < x.n_blocks(); ++b) {
+    if (x.block_sizes()[b] == 0) continue;
+    auto ev_b = nda::linalg::eigenvalues(x.block(b));
+    EXPECT_ARRAY_NEAR(ev(x.block_range(b)), ev_b, 1.e-12);
+  }
+  EXPECT_ARRAY_NEAR(nda::linalg::eigenvalues(x), ev, 1.e-12);
+  auto V = vecs.to_dense();
+  EXPECT_ARRAY_NEAR(X * V, V * nda::diag(ev), 1.e-12);
+}
+
+TEST(BlockMatrix, Algebra) { test_block_algebra<double>({3, 1, 4, 2}); }    //NOLINT
+TEST(BlockMatrix, AlgebraC) { test_block_algebra<dcomplex>({3, 1, 4, 2}); } //NOLINT
+
+TEST(BlockMatrix, EmptyBlock) { //NOLINT
+  test_block_algebra<double>({2, 0, 3});
+  test_block_algebra<dcomplex>({0, 2, 0, 3, 0});
+}
+
+// ==============================================================
+
+TEST(BlockMatrix, SingularBlock) { //NOLINT
+  auto x                  = make_blocks<double>({2, 2});
+  x.block(1)              = 0;
+  EXPECT_THROW(nda::inverse(x), nda::runtime_error); //NOLINT
+  EXPECT_NEAR(nda::determinant(x), 0, 1.e-14);
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#include "./test_common.hpp"
+#include <nda/linalg/contract.hpp>
+
+using nda::range;
+
+// ==============================================================
+
+TEST(Contract, Matmul) { //NOLINT
+  nda::matrix<double> A = {{1, 2, 3}, {4, 5, 6}};
+  nda::matrix<double> B = {{1, 2}, {0, 1}, {-1, 3}};
+
+  EXPECT_ARRAY_NEAR(nda::contract<"ik,kj->ij">(A, B), A * B, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::contract<"ik,kj->ji">(A, B), transpose(A * B), 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::contract<"ki,jk->ij">(transpose(A), transpose(B)), A * B, 1.e-14);
+
+  // Outer product, mixed value types and expressions
+  nda::array<long, 1> v = {1, 2};
+  EXPECT_ARRAY_NEAR(nda::contract<"ij,k->ijk">(A, v)(_, _, 1), 2 * A, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::contract<"ik,kj->ij">(A, 2 * B), 2 * A * B, 1.e-14);
+}
+
+// ==============================================================
+
+// Reference implementation of r(i,j,m,n) = sum_{k,l} a(i,j,k,l) b(k,l,m,n), labels permuted by the callers
+template <typename A, typename B, typename F>
+auto contract_4_ref(A const &a, B const &b, F const &a_at, F const &b_at, long n) {
+  nda::array<double, 4> r(n, n, n, n);
+  for (auto [i, j, m, p] : r.indices()) {
+    double acc = 0;
+    for (long k = 0; k < n; ++k)
+      for (long l = 0; l < n; ++l) acc += a_at(a, i, j, k, l) * b_at(b, k, l, m, p);
+    r(i, j, m, p) = acc;
+  }
+  return r;
+}
+
+TEST(Contract, Rank4) { //NOLINT
+  long n = 3;
+  auto a = nda::rand<double>(n, n, n, n);
+  auto b = nda::rand<double>(n, n, n, n);
+
+  auto id = [](auto const &x, long i, long j, long k, long l) { return x(i, j, k, l); };
+  auto r  = contract_4_ref(a, b, id, id, n);
+
+  // Indices mergeable in place
+  EXPECT_ARRAY_NEAR(nda::contract<"ijkl,klmn->ijmn">(a, b), r, 1.e-13);
+
+  // Contracted indices in different orders in a and b : b needs a transposition
+  auto b2 = nda::array<double, 4>{nda::permuted_indices_view<nda::encode(std::array{1, 0, 2, 3})>(b)};
+  EXPECT_ARRAY_NEAR(nda::contract<"ijkl,lkmn->ijmn">(a, b2), r, 1.e-13);
+
+  // Interleaved free indices in the result : the result needs a transposition
+  auto r2 = nda::contract<"ijkl,klmn->imjn">(a, b);
+  for (auto [i, m, j, p] : r2.indices()) EXPECT_NEAR(r2(i, m, j, p), r(i, j, m, p), 1.e-13);
+
+  // Non contiguous views
+  auto A = nda::rand<double>(n, 2 * n, n, n);
+  A(_, range(0, 2 * n, 2), _, _) = a;
+  EXPECT_ARRAY_NEAR(nda::contract<"ijkl,klmn->ijmn">(A(_, range(0, 2 * n, 2), _, _), b), r, 1.e-13);
+
+  // Contraction over 3 indices, rank 6 operand
+  auto c  = nda::rand<double>(2, 3, 4, 2, 3, 2);
+  auto d  = nda::rand<double>(4, 2, 3, 5);
+  auto cd = nda::contract<"abcdef,cdeg->abfg">(c, d);
+  EXPECT_EQ(cd.shape(), (std::array<long, 4>{2, 3, 2, 5}));
+  for (auto [x, y, f, g] : cd.indices()) {
+    double acc = 0;
+    for (auto [k, l, m] : nda::array<int, 3>(4, 2, 3).indices()) acc += c(x, y, k, l, m, f) * d(k, l, m, g);
+    EXPECT_NEAR(cd(x, y, f, g), acc, 1.e-13);
+  }
+}
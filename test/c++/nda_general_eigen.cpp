@@ -0,0 +1,183 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// A hermitian matrix h and a positive definite overlap s
+template <typename T, typename Layout>
+std::pair<nda::matrix<T, Layout>, nda::matrix<T, Layout>> make_generalized(long n) {
+  auto g = make_test_matrix<T, Layout>(n, n, 0, 1);
+  return {make_test_hermitian<T, Layout>(n), nda::matrix<T, Layout>(nda::dagger(g) * g / double(n) + nda::eye<T>(n))};
+}
+
+// ==============================================================
+
+template <typename T, typename Layout>
+void test_general_eigenelements() {
+  long n       = 6;
+  auto a       = make_test_matrix<T, Layout>(n, n);
+  auto ac      = nda::matrix<dcomplex>(a);
+  auto [w, vr] = nda::linalg::general_eigenelements(a);
+  EXPECT_EQ(w.size(), n);
+  for (long j = 0; j < n; ++j) EXPECT_ARRAY_NEAR(ac * vr(nda::range::all, j), w(j) * vr(nda::range::all, j), 1.e-12);
+
+  auto [w2, vl, vr2] = nda::linalg::general_eigenelements_left_right(a);
+  EXPECT_ARRAY_NEAR(w, w2, 1.e-12);
+  for (long j = 0; j < n; ++j) {
+    EXPECT_ARRAY_NEAR(ac * vr2(nda::range::all, j), w(j) * vr2(nda::range::all, j), 1.e-12);
+    EXPECT_ARRAY_NEAR(dagger(ac) * vl(nda::range::all, j), nda::conj(w(j)) * vl(nda::range::all, j), 1.e-12);
+    EXPECT_NEAR(std::abs(nda::blas::dotc(vr2(nda::range::all, j), vr2(nda::range::all, j))), 1.0, 1.e-12);
+  }
+  EXPECT_ARRAY_NEAR(nda::linalg::general_eigenvalues(a), w, 1.e-12);
+
+  // a real matrix with a non trivial complex spectrum
+  if constexpr (not nda::is_complex_v<T>) {
+    long n_complex = 0;
+    for (auto x : w) n_complex += (std::abs(x.imag()) > 1.e-8);
+    EXPECT_GT(n_complex, 0);
+  }
+}
+
+TEST(GeneralEigen, Eigenelements) { //NOLINT
+  for_each_type_and_layout([](auto t, auto l) { test_general_eigenelements<decltype(t), decltype(l)>(); });
+}
+
+// --------------------------------------------------------------
+
+TEST(GeneralEigen, InPlace) { //NOLINT
+  long n  = 5;
+  auto w  = nda::array<dcomplex, 1>{};
+  auto vl = nda::matrix<dcomplex, nda::F_layout>{};
+  auto vr = nda::matrix<dcomplex>{};
+
+  // repeated calls reuse the workspaces and the outputs
+  for (int k = 0; k < 3; ++k) {
+    auto a  = make_test_matrix<double, nda::C_layout>(n + k, n + k);
+    auto ac = nda::matrix<dcomplex>(a);
+    nda::linalg::general_eigenelements_in_place(a, w, vl, vr);
+    EXPECT_EQ(w.size(), n + k);
+    for (long j = 0; j < n + k; ++j) {
+      EXPECT_ARRAY_NEAR(ac * vr(nda::range::all, j), w(j) * vr(nda::range::all, j), 1.e-12);
+      EXPECT_ARRAY_NEAR(dagger(ac) * vl(nda::range::all, j), nda::conj(w(j)) * vl(nda::range::all, j), 1.e-12);
+    }
+  }
+
+  // a view as input
+  auto big = make_test_matrix<dcomplex, nda::F_layout>(8, 8);
+  auto ref = nda::matrix<dcomplex>(big(nda::range(1, 6), nda::range(1, 6)));
+  auto v   = big(nda::range(1, 6), nda::range(1, 6));
+  nda::linalg::general_eigenelements_in_place(v, w, vr);
+  for (long j = 0; j < 5; ++j) EXPECT_ARRAY_NEAR(ref * vr(nda::range::all, j), w(j) * vr(nda::range::all, j), 1.e-12);
+
+  auto a     = make_test_matrix<double, nda::F_layout>(n, n);
+  auto w_ref = nda::linalg::general_eigenvalues(a);
+  EXPECT_ARRAY_NEAR(nda::linalg::general_eigenvalues_in_place(a), w_ref, 1.e-12);
+
+  // lapack::geev without eigenvectors does not reference vl and vr
+  auto a2 = make_test_matrix<double, nda::F_layout>(n, n);
+  auto v0 = nda::matrix<double, nda::F_layout>{};
+  EXPECT_EQ(nda::lapack::geev(a2, w, v0, v0, 'N', 'N'), 0);
+  EXPECT_ARRAY_NEAR(w, w_ref, 1.e-12);
+  EXPECT_TRUE(v0.empty());
+}
+
+// --------------------------------------------------------------
+
+TEST(GeneralEigen, Workspace) { //NOLINT
+  long n  = 6;
+  auto ws = nda::lapack::eigen_workspace<double>{};
+  auto w  = nda::array<dcomplex, 1>{};
+  auto vl = nda::matrix<dcomplex>{};
+  auto vr = nda::matrix<dcomplex>{};
+  auto a  = make_test_matrix<double, nda::C_layout>(n, n);
+  auto ac = nda::matrix<dcomplex>(a);
+  nda::linalg::general_eigenelements_in_place(nda::matrix<double>{a}, w, vl, vr, ws);
+  auto *work = ws.work.data(), *v1 = ws.v1.data(), *v2 = ws.v2.data();
+
+  // the calls with the same or a smaller dimension do not reallocate the workspace
+  for (long k : {n, n - 2}) {
+    auto ak  = nda::matrix<double>{a(nda::range(0, k), nda::range(0, k))};
+    auto akc = nda::matrix<dcomplex>(ak);
+    nda::linalg::general_eigenelements_in_place(ak, w, vl, vr, ws);
+    EXPECT_EQ(ws.work.data(), work);
+    EXPECT_EQ(ws.v1.data(), v1);
+    EXPECT_EQ(ws.v2.data(), v2);
+    for (long j = 0; j < k; ++j) {
+      EXPECT_ARRAY_NEAR(akc * vr(nda::range::all, j), w(j) * vr(nda::range::all, j), 1.e-12);
+      EXPECT_ARRAY_NEAR(dagger(akc) * vl(nda::range::all, j), nda::conj(w(j)) * vl(nda::range::all, j), 1.e-12);
+    }
+  }
+
+  // the generalized problem
+  auto [h, s] = make_generalized<dcomplex, nda::F_layout>(n);
+  auto ev     = nda::linalg::generalized_eigenvalues(h, s);
+  auto ws2    = nda::lapack::eigen_workspace<dcomplex>{};
+  auto solve  = [&]() {
+    auto h1 = h;
+    auto s1 = s;
+    EXPECT_ARRAY_NEAR(nda::linalg::generalized_eigenelements_in_place(h1, s1, ws2), ev, 1.e-12);
+    for (long j = 0; j < n; ++j) EXPECT_ARRAY_NEAR(h * h1(nda::range::all, j), ev(j) * s * h1(nda::range::all, j), 1.e-12);
+  };
+  solve();
+  auto *work2  = ws2.work.data();
+  auto *rwork2 = ws2.rwork.data();
+  auto *iwork2 = ws2.iwork.data();
+  solve();
+  EXPECT_EQ(ws2.work.data(), work2);
+  EXPECT_EQ(ws2.rwork.data(), rwork2);
+  EXPECT_EQ(ws2.iwork.data(), iwork2);
+}
+
+// ==============================================================
+
+template <typename T, typename Layout>
+void test_generalized_eigenelements() {
+  long n       = 7;
+  auto [h, s]  = make_generalized<T, Layout>(n);
+  auto [ev, x] = nda::linalg::generalized_eigenelements(h, s);
+  EXPECT_EQ(ev.size(), n);
+  for (long j = 1; j < n; ++j) EXPECT_LE(ev(j - 1), ev(j));
+  for (long j = 0; j < n; ++j) EXPECT_ARRAY_NEAR(h * x(nda::range::all, j), ev(j) * s * x(nda::range::all, j), 1.e-12);
+  EXPECT_ARRAY_NEAR(dagger(x) * s * x, nda::eye<T>(n), 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::linalg::generalized_eigenvalues(h, s), ev, 1.e-12);
+
+  // in place : h is overwritten by the eigenvectors
+  auto h1  = h;
+  auto s1  = s;
+  auto ev1 = nda::linalg::generalized_eigenelements_in_place(h1, s1);
+  EXPECT_ARRAY_NEAR(ev1, ev, 1.e-12);
+  for (long j = 0; j < n; ++j) EXPECT_ARRAY_NEAR(h * h1(nda::range::all, j), ev(j) * s * h1(nda::range::all, j), 1.e-12);
+
+  auto h2 = h;
+  auto s2 = s;
+  EXPECT_ARRAY_NEAR(nda::linalg::generalized_eigenvalues_in_place(h2, s2), ev, 1.e-12);
+
+  // consistent with the standard problem for s = 1
+  auto one = nda::matrix<T, Layout>(nda::eye<T>(n));
+  EXPECT_ARRAY_NEAR(nda::linalg::generalized_eigenvalues(h, one), nda::linalg::eigenvalues(h), 1.e-12);
+}
+
+TEST(GeneralizedEigen, Eigenelements) { //NOLINT
+  for_each_type_and_layout([](auto t, auto l) { test_generalized_eigenelements<decltype(t), decltype(l)>(); });
+}
+
+// --------------------------------------------------------------
+
+TEST(GeneralizedEigen, NotPositiveDefinite) { //NOLINT
+  auto [h, s] = make_generalized<double, nda::F_layout>(4);
+  s(2, 2)     = -1;
+  EXPECT_THROW(nda::linalg::generalized_eigenelements(h, s), nda::runtime_error);
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// Reference product with gemm
+template <typename L, typename R>
+auto gemm_product(L const &l, R const &r) {
+  using T = nda::get_value_t<L>;
+  auto c  = nda::matrix<T>(l.shape()[0], r.shape()[1]);
+  nda::blas::gemm(1, nda::matrix<T>{l}, nda::matrix<T>{r}, 0, c);
+  return c;
+}
+
+// ==============================================================
+
+template <typename T, typename LayoutA, typename LayoutC>
+void test_syrk() {
+  auto a = make_test_matrix<T, LayoutA>(5, 3);
+  for (char op : {'N', 'T'}) {
+    long n = (op == 'N' ? 5 : 3);
+    auto c = nda::matrix<T, LayoutC>(n, n);
+    nda::blas::syrk(1, a, 0, c, op);
+    auto expected = (op == 'N' ? gemm_product(a, transpose(a)) : gemm_product(transpose(a), a));
+    EXPECT_ARRAY_NEAR(c, expected, 1.e-13);
+
+    // beta != 0 : c <- 2 * op(a) op(a)^T - c
+    nda::blas::syrk(2, a, -1, c, op);
+    EXPECT_ARRAY_NEAR(c, expected, 1.e-13);
+  }
+}
+
+TEST(Gram, syrk) { //NOLINT
+  test_syrk<double, nda::C_layout, nda::C_layout>();
+  test_syrk<double, nda::C_layout, nda::F_layout>();
+  test_syrk<double, nda::F_layout, nda::C_layout>();
+  test_syrk<double, nda::F_layout, nda::F_layout>();
+  test_syrk<dcomplex, nda::C_layout, nda::F_layout>();
+  test_syrk<dcomplex, nda::F_layout, nda::C_layout>();
+}
+
+// ==============================================================
+
+template <typename LayoutA, typename LayoutC>
+void test_herk() {
+  auto a = make_test_matrix<dcomplex, LayoutA>(5, 3);
+  for (char op : {'N', 'C'}) {
+    long n = (op == 'N' ? 5 : 3);
+    auto c = nda::matrix<dcomplex, LayoutC>(n, n);
+    nda::blas::herk(1, a, 0, c, op);
+    auto expected = (op == 'N' ? gemm_product(a, dagger(a)) : gemm_product(dagger(a), a));
+    EXPECT_ARRAY_NEAR(c, expected, 1.e-13);
+
+    nda::blas::herk(2, a, -1, c, op);
+    EXPECT_ARRAY_NEAR(c, expected, 1.e-13);
+  }
+}
+
+TEST(Gram, herk) { //NOLINT
+  test_herk<nda::C_layout, nda::C_layout>();
+  test_herk<nda::C_layout, nda::F_layout>();
+  test_herk<nda::F_layout, nda::C_layout>();
+  test_herk<nda::F_layout, nda::F_layout>();
+}
+
+// ==============================================================
+
+TEST(Gram, gram) { //NOLINT
+  auto ad = make_test_matrix<double, nda::C_layout>(6, 4);
+  EXPECT_ARRAY_NEAR(nda::gram(ad), gemm_product(transpose(ad), ad), 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::gram(ad, 'N'), gemm_product(ad, transpose(ad)), 1.e-13);
+
+  auto az = make_test_matrix<dcomplex, nda::F_layout>(6, 4);
+  EXPECT_ARRAY_NEAR(nda::gram(az), gemm_product(dagger(az), az), 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::gram(az, 'N'), gemm_product(az, dagger(az)), 1.e-13);
+
+  // Strided views and lazy expressions are copied first
+  auto sub = az(range(0, 6, 2), range(1, 4));
+  EXPECT_ARRAY_NEAR(nda::gram(sub), gemm_product(dagger(sub), sub), 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::gram(2 * ad), 4 * gemm_product(transpose(ad), ad), 1.e-12);
+}
+
+// ==============================================================
+
+TEST(Gram, MatmulTransposedPair) { //NOLINT
+  auto a = make_test_matrix<double, nda::C_layout>(6, 4);
+  auto b = make_test_matrix<double, nda::F_layout>(6, 4);
+
+  nda::matrix<double> aat = a * transpose(a);
+  EXPECT_ARRAY_NEAR(aat, gemm_product(a, transpose(a)), 1.e-13);
+  EXPECT_EQ_ARRAY(aat, nda::matrix<double>{transpose(aat)});
+
+  EXPECT_ARRAY_NEAR(nda::matrix<double>{transpose(b) * b}, gemm_product(transpose(b), b), 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::matrix<double>{dagger(a) * a}, gemm_product(transpose(a), a), 1.e-13);
+
+  // A sub view and its transpose
+  auto s = a(range(1, 5), range(0, 3));
+  EXPECT_ARRAY_NEAR(nda::matrix<double>{s * transpose(s)}, gemm_product(s, transpose(s)), 1.e-13);
+
+  // Same storage, not a transpose : gemm
+  auto sq = make_test_matrix<double, nda::C_layout>(4, 4);
+  EXPECT_ARRAY_NEAR(nda::matrix<double>{sq * sq}, gemm_product(sq, sq), 1.e-13);
+
+  // Complex : a * a^T is symmetric, computed by syrk
+  auto z = make_test_matrix<dcomplex, nda::F_layout>(5, 3);
+  EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>{z * transpose(z)}, gemm_product(z, transpose(z)), 1.e-13);
+}
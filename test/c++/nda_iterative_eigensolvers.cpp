@@ -0,0 +1,156 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+#include <nda/sparse.hpp>
+
+using namespace nda::linalg;
+
+// A hermitian matrix with a dominant, spread diagonal and small couplings
+template <typename T>
+nda::matrix<T> make_hamiltonian(long n, double coupling) {
+  auto h = nda::matrix<T>{coupling * make_test_hermitian<T>(n)};
+  for (long i = 0; i < n; ++i) h(i, i) = 0.1 * ((7 * i) % n) + 0.01 * i;
+  return h;
+}
+
+// Check the eigenpairs against a dense diagonalization
+template <typename T, typename M>
+void check_eigenpairs(M const &h, eigensolver_result<T> const &res, long nev, double tol) {
+  EXPECT_TRUE(res.converged);
+  auto ev_exact = nda::linalg::eigenvalues(h);
+  EXPECT_EQ(res.eigenvalues.size(), nev);
+  EXPECT_ARRAY_NEAR(res.eigenvalues, ev_exact(range(0, nev)), tol);
+  for (long i = 0; i < nev; ++i) {
+    auto x = nda::array<T, 1>{res.eigenvectors(range::all, i)};
+    auto r = nda::array<T, 1>{nda::matvecmul(h, x) - res.eigenvalues(i) * x};
+    EXPECT_NEAR(std::sqrt(std::real(nda::blas::dotc(x, x))), 1, 1.e-10);
+    EXPECT_LT(std::sqrt(std::real(nda::blas::dotc(r, r))), 1.e-6);
+  }
+}
+
+// ==============================================================
+
+template <typename T>
+void test_lanczos() {
+  long n = 200;
+  auto h = make_hamiltonian<T>(n, 0.05);
+
+  // Dense matrix operator, with restarts
+  auto res = lanczos<T>(h, n, 4, {.tol = 1.e-12, .max_basis = 20, .seed = 1});
+  check_eigenpairs(h, res, 4, 1.e-9);
+  EXPECT_GT(res.n_iter, 0);
+
+  // Matrix free operator
+  auto apply_h = [&h](auto const &x, auto &&y) { nda::matvecmul_into(y, h, x); };
+  auto solver  = lanczos_solver<T>{{.tol = 1.e-12, .seed = 2}};
+  check_eigenpairs(h, solver.solve(apply_h, n, 3), 3, 1.e-9);
+
+  // Reuse of the workspace
+  check_eigenpairs(h, solver.solve(apply_h, n, 3), 3, 1.e-9);
+
+  // The basis spans the whole space
+  long n_small = 6;
+  auto hs      = make_hamiltonian<T>(n_small, 0.3);
+  check_eigenpairs(hs, lanczos<T>(hs, n_small, 2, {.seed = 3}), 2, 1.e-10);
+}
+
+TEST(IterativeEigensolvers, Lanczos) { //NOLINT
+  test_lanczos<double>();
+  test_lanczos<dcomplex>();
+}
+
+// ==============================================================
+
+template <typename T>
+void test_davidson() {
+  long n    = 200;
+  auto h    = make_hamiltonian<T>(n, 0.02);
+  auto diag = nda::array<double, 1>(n);
+  for (long i = 0; i < n; ++i) diag(i) = std::real(h(i, i));
+
+  auto res = davidson<T>(h, diag, 3, {.tol = 1.e-12});
+  check_eigenpairs(h, res, 3, 1.e-9);
+
+  // A small basis, collapsed several times, and an operator returning A(x)
+  auto apply_h = [&h](auto const &x) { return nda::matvecmul(h, x); };
+  auto res2    = davidson_solver<T>{{.tol = 1.e-12, .max_basis = 8}}.solve(apply_h, diag, 4);
+  check_eigenpairs(h, res2, 4, 1.e-9);
+}
+
+TEST(IterativeEigensolvers, Davidson) { //NOLINT
+  test_davidson<double>();
+  test_davidson<dcomplex>();
+}
+
+// ==============================================================
+
+// Single precision, with the default tolerance, checked against a dense diagonalization in double precision
+template <typename T>
+void test_single_precision(long n) {
+  using D   = std::conditional_t<nda::is_complex_v<T>, dcomplex, double>;
+  auto h_d  = make_hamiltonian<D>(n, 0.05);
+  auto h    = nda::matrix<T>(n, n);
+  auto diag = nda::array<float, 1>(n);
+  for (long i = 0; i < n; ++i) {
+    for (long j = 0; j < n; ++j) h(i, j) = T(h_d(i, j));
+    diag(i) = std::real(h(i, i));
+  }
+  auto ev_exact = nda::linalg::eigenvalues(h_d);
+
+  auto check = [&](eigensolver_result<T> const &res, long nev) {
+    EXPECT_TRUE(res.converged);
+    EXPECT_LT(res.n_iter, 1000);
+    for (long i = 0; i < nev; ++i) {
+      EXPECT_NEAR(res.eigenvalues(i), ev_exact(i), 1.e-4);
+      EXPECT_LT(res.residuals(i), 1.e-3);
+    }
+  };
+  check(lanczos<T>(h, n, 2, {.seed = 1}), 2);
+  check(davidson<T>(h, diag, 2), 2);
+}
+
+TEST(IterativeEigensolvers, SinglePrecision) { //NOLINT
+  for (long n : {6, 100}) {
+    test_single_precision<float>(n);
+    test_single_precision<std::complex<float>>(n);
+  }
+}
+
+// ==============================================================
+
+TEST(IterativeEigensolvers, SparseOperator) { //NOLINT
+  // 1d tight binding chain in a potential
+  long n = 400;
+  auto h = nda::matrix<double>::zeros({n, n});
+  for (long i = 0; i < n; ++i) {
+    h(i, i) = 0.02 * i + 0.5 * std::cos(0.37 * i);
+    if (i + 1 < n) h(i, i + 1) = h(i + 1, i) = -0.3;
+  }
+  auto s = nda::sparse::csr_matrix{h};
+
+  auto res = lanczos<double>(s, n, 2, {.tol = 1.e-11, .max_basis = 60, .seed = 4});
+  check_eigenpairs(h, res, 2, 1.e-8);
+
+  auto diag = nda::array<double, 1>{nda::diagonal(h)};
+  auto res2 = davidson<double>(s, diag, 2, {.tol = 1.e-11, .max_basis = 40});
+  check_eigenpairs(h, res2, 2, 1.e-8);
+
+  // Not enough iterations
+  auto res3 = lanczos<double>(s, n, 2, {.max_basis = 10, .max_iter = 1, .seed = 5});
+  EXPECT_FALSE(res3.converged);
+  EXPECT_EQ(res3.eigenvectors.shape(), (std::array<long, 2>{n, 2}));
+}
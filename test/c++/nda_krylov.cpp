@@ -0,0 +1,217 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+#include <nda/sparse.hpp>
+
+using namespace nda::linalg;
+
+// 1d Laplacian with a shift : symmetric positive definite
+template <typename T>
+nda::matrix<T> make_spd(long n) {
+  auto a = nda::matrix<T>::zeros({n, n});
+  for (long i = 0; i < n; ++i) {
+    a(i, i) = 2.5 + 0.01 * i;
+    if (i + 1 < n) {
+      if constexpr (nda::is_complex_v<T>) {
+        a(i, i + 1) = T{-1, 0.2};
+        a(i + 1, i) = T{-1, -0.2};
+      } else {
+        a(i, i + 1) = a(i + 1, i) = -1;
+      }
+    }
+  }
+  return a;
+}
+
+template <typename T>
+nda::array<T, 1> make_rhs(long n) {
+  auto b = nda::array<T, 1>(n);
+  for (long i = 0; i < n; ++i) b(i) = std::cos(0.3 * i) + 0.5;
+  return b;
+}
+
+// || b - a * x || / || b ||
+template <typename A, typename B, typename X>
+double true_residual(A const &a, B const &b, X const &x) {
+  auto r = nda::array<nda::get_value_t<X>, 1>{b - nda::matvecmul(a, x)};
+  return std::sqrt(std::real(nda::blas::dotc(r, r)) / std::real(nda::blas::dotc(b, b)));
+}
+
+// ==============================================================
+
+template <typename T>
+void test_cg() {
+  long n = 40;
+  auto a = make_spd<T>(n);
+  auto b = make_rhs<T>(n);
+
+  // Dense matrix operator
+  auto x   = nda::zeros<T>(n);
+  auto res = cg(a, b, x);
+  EXPECT_TRUE(res.converged);
+  EXPECT_LT(res.residual, 1.e-10);
+  EXPECT_LT(true_residual(a, b, x), 1.e-9);
+
+  // Matrix free operator y = A(x) and a Jacobi preconditioner, both writing into their output
+  auto apply_a = [&a](auto const &v, auto &&y) { nda::matvecmul_into(y, a, v); };
+  auto jacobi  = [&a](auto const &r, auto &&z) {
+    for (long i = 0; i < r.size(); ++i) z(i) = r(i) / a(i, i);
+  };
+  auto solver = cg_solver<T>{{.rtol = 1.e-12}};
+  auto x2     = nda::zeros<T>(n);
+  auto res2   = solver.solve(apply_a, b, x2, jacobi);
+  EXPECT_TRUE(res2.converged);
+  EXPECT_LT(true_residual(a, b, x2), 1.e-11);
+
+  // Reuse of the workspace, from the solution as initial guess
+  auto res3 = solver.solve(apply_a, b, x2, jacobi);
+  EXPECT_TRUE(res3.converged);
+  EXPECT_EQ(res3.n_iter, 0);
+
+  // Not enough iterations
+  auto x4   = nda::zeros<T>(n);
+  auto res4 = cg(a, b, x4, {.max_iter = 2});
+  EXPECT_FALSE(res4.converged);
+  EXPECT_EQ(res4.n_iter, 2);
+}
+
+TEST(Krylov, CG) { //NOLINT
+  test_cg<double>();
+  test_cg<dcomplex>();
+}
+
+// ==============================================================
+
+template <typename T, typename Solver>
+void test_general_solver() {
+  long n = 30;
+  // A diagonally dominant, non symmetric matrix
+  auto a = nda::matrix<T>{make_test_matrix<T>(n, n, 2.0 * n) / double(n)};
+  auto b = make_rhs<T>(n);
+
+  // Operator returning A(x)
+  auto apply_a = [&a](auto const &v) { return nda::matvecmul(a, v); };
+  auto solver  = Solver{{.rtol = 1.e-12, .restart = 10}};
+  auto x       = nda::zeros<T>(n);
+  auto res     = solver.solve(apply_a, b, x);
+  EXPECT_TRUE(res.converged);
+  EXPECT_LT(true_residual(a, b, x), 1.e-11);
+
+  // Jacobi preconditioner, as a diagonal matrix
+  auto d = nda::matrix<T>::zeros({n, n});
+  for (long i = 0; i < n; ++i) d(i, i) = 1.0 / a(i, i);
+  auto x2   = nda::zeros<T>(n);
+  auto res2 = solver.solve(a, b, x2, d);
+  EXPECT_TRUE(res2.converged);
+  EXPECT_LT(true_residual(a, b, x2), 1.e-11);
+
+  // Several right hand sides, solved into a strided view
+  auto B = nda::matrix<T>(n, 3);
+  for (long k = 0; k < 3; ++k) B(range::all, k) = make_rhs<T>(n) * (k + 1.0);
+  auto X    = nda::matrix<T>::zeros({n, 5});
+  auto Xv   = X(range::all, range(0, 5, 2));
+  auto ress = solver.solve(a, B, Xv);
+  EXPECT_EQ(ress.size(), 3);
+  for (long k = 0; k < 3; ++k) {
+    EXPECT_TRUE(ress[k].converged);
+    EXPECT_LT(true_residual(a, nda::array<T, 1>(B(range::all, k)), nda::array<T, 1>(Xv(range::all, k))), 1.e-11);
+  }
+}
+
+TEST(Krylov, BiCGStab) { //NOLINT
+  test_general_solver<double, bicgstab_solver<double>>();
+  test_general_solver<dcomplex, bicgstab_solver<dcomplex>>();
+}
+
+TEST(Krylov, GMRES) { //NOLINT
+  test_general_solver<double, gmres_solver<double>>();
+  test_general_solver<dcomplex, gmres_solver<dcomplex>>();
+
+  // Full GMRES converges in at most n iterations
+  long n   = 12;
+  auto a   = nda::matrix<double>{make_test_matrix<double>(n, n, 2.0 * n) / double(n)};
+  auto b   = make_rhs<double>(n);
+  auto x   = nda::zeros<double>(n);
+  auto res = gmres(a, b, x, {.rtol = 1.e-13, .restart = n});
+  EXPECT_TRUE(res.converged);
+  EXPECT_LE(res.n_iter, n);
+}
+
+// ==============================================================
+
+template <typename T>
+void test_single_precision() {
+  long n    = 30;
+  auto opts = krylov_options{.rtol = 1.e-5, .restart = 10};
+  auto a    = nda::matrix<T>{make_test_matrix<T>(n, n, 2.0 * n) / double(n)};
+  auto b    = make_rhs<T>(n);
+
+  auto x = nda::zeros<T>(n);
+  EXPECT_TRUE(bicgstab(a, b, x, opts).converged);
+  EXPECT_LT(true_residual(a, b, x), 1.e-4);
+
+  auto x2 = nda::zeros<T>(n);
+  EXPECT_TRUE(gmres(a, b, x2, opts).converged);
+  EXPECT_LT(true_residual(a, b, x2), 1.e-4);
+
+  auto s  = make_spd<T>(n);
+  auto x3 = nda::zeros<T>(n);
+  EXPECT_TRUE(cg(s, b, x3, opts).converged);
+  EXPECT_LT(true_residual(s, b, x3), 1.e-4);
+
+  // A diagonal system
+  auto d  = nda::matrix<T>{{1, 0, 0}, {0, 2, 0}, {0, 0, 4}};
+  auto bd = nda::array<T, 1>{1, 1, 1};
+  auto xd = nda::zeros<T>(3);
+  EXPECT_TRUE(gmres(d, bd, xd, opts).converged);
+  EXPECT_ARRAY_NEAR(xd, (nda::array<T, 1>{1, 0.5, 0.25}), 1.e-6);
+  xd = 0;
+  EXPECT_TRUE(bicgstab(d, bd, xd, opts).converged);
+  EXPECT_ARRAY_NEAR(xd, (nda::array<T, 1>{1, 0.5, 0.25}), 1.e-6);
+}
+
+TEST(Krylov, SinglePrecision) { //NOLINT
+  test_single_precision<float>();
+  test_single_precision<std::complex<float>>();
+}
+
+// ==============================================================
+
+TEST(Krylov, SparseOperator) { //NOLINT
+  long n = 50;
+  auto a = make_spd<double>(n);
+  auto s = nda::sparse::csr_matrix{a};
+  auto b = make_rhs<double>(n);
+
+  auto x = nda::zeros<double>(n);
+  EXPECT_TRUE(cg(s, b, x).converged);
+  EXPECT_LT(true_residual(a, b, x), 1.e-9);
+
+  auto x2 = nda::zeros<double>(n);
+  EXPECT_TRUE(bicgstab(s, b, x2).converged);
+  EXPECT_LT(true_residual(a, b, x2), 1.e-9);
+
+  auto x3 = nda::zeros<double>(n);
+  EXPECT_TRUE(gmres(s, b, x3).converged);
+  EXPECT_LT(true_residual(a, b, x3), 1.e-9);
+
+  // Zero right hand side
+  auto x4 = make_rhs<double>(n);
+  auto r4 = gmres(s, nda::zeros<double>(n), x4);
+  EXPECT_TRUE(r4.converged);
+  EXPECT_ARRAY_ZERO(x4);
+}
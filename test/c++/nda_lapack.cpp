@@ -137,6 +137,55 @@ TEST(lapack, gesvd) { //NOLINT
   EXPECT_ARRAY_NEAR(a_copy, U * S_Mat * VT, 1e-14);
 }
 
+// ==================================== gesdd ============================================
+
+template <typename T>
+void test_gesdd(long M, long N) {
+  auto A = make_test_matrix<T, F_layout>(M, N);
+  long K = std::min(M, N);
+
+  // Reference : gesvd, full
+  auto S_ref = array<double, 1>(K);
+  {
+    auto a  = A;
+    auto U  = matrix<T, F_layout>(M, M);
+    auto VT = matrix<T, F_layout>(N, N);
+    lapack::gesvd(a, S_ref, U, VT);
+  }
+
+  // Full, thin and values only, with gesdd and gesvd
+  for (char job : {'A', 'S', 'N'}) {
+    long ku = (job == 'A' ? M : K), kv = (job == 'A' ? N : K);
+    auto a  = A;
+    auto S  = array<double, 1>{};
+    auto U  = matrix<T, F_layout>{};
+    auto VT = matrix<T, F_layout>{};
+    lapack::gesdd(a, S, U, VT, job);
+    EXPECT_ARRAY_NEAR(S, S_ref, 1e-13);
+    if (job == 'N') continue;
+    EXPECT_EQ(U.shape(), (std::array<long, 2>{M, ku}));
+    EXPECT_EQ(VT.shape(), (std::array<long, 2>{kv, N}));
+
+    auto S_mat = matrix<T, F_layout>::zeros({ku, kv});
+    for (long i = 0; i < K; ++i) S_mat(i, i) = S(i);
+    EXPECT_ARRAY_NEAR(A, matrix<T, F_layout>{U * S_mat * VT}, 1e-13);
+
+    auto a2  = A;
+    auto S2  = array<double, 1>(K);
+    auto U2  = matrix<T, F_layout>(M, ku);
+    auto VT2 = matrix<T, F_layout>(kv, N);
+    lapack::gesvd(a2, S2, U2, VT2, job);
+    EXPECT_ARRAY_NEAR(A, matrix<T, F_layout>{U2 * S_mat * VT2}, 1e-13);
+  }
+}
+
+TEST(lapack, gesdd) { //NOLINT
+  for (auto [M, N] : std::vector<std::pair<long, long>>{{6, 4}, {4, 6}, {5, 5}, {1, 3}}) {
+    test_gesdd<double>(M, N);
+    test_gesdd<dcomplex>(M, N);
+  }
+}
+
 // =================================== gelss =======================================
 
 TEST(lapack, gelss) { //NOLINT
@@ -166,6 +215,52 @@ TEST(lapack, gelss) { //NOLINT
   //EXPECT_ARRAY_NEAR(x_exact, x_2, 1e-14);
 }
 
+TEST(lapack, gelss_batched) { //NOLINT
+
+  long M = 7, N = 3, NRHS = 4, NBATCH = 5;
+  auto A = matrix<double>(M, N);
+  for (long i = 0; i < M; ++i)
+    for (long j = 0; j < N; ++j) A(i, j) = std::pow(0.3 * i, j) + 0.1 * std::sin(i + j);
+  auto B = array<double, 3>(NBATCH, M, NRHS);
+  for (long b = 0; b < NBATCH; ++b)
+    for (long i = 0; i < M; ++i)
+      for (long j = 0; j < NRHS; ++j) B(b, i, j) = std::cos(1.0 + b + 2 * i + 3 * j);
+
+  auto lss = lapack::gelss_worker<double>{A};
+  EXPECT_EQ(lss.n_var(), N);
+
+  // The error estimate is the largest residual norm of a column, the residual being orthogonal to the range of A
+  auto max_residual = [&](auto const &b, auto const &x) {
+    auto r   = matrix<double>{A * x - b};
+    double e = 0;
+    for (long j = 0; j < r.extent(1); ++j) e = std::max(e, frobenius_norm(r(range(), range(j, j + 1))));
+    return e / std::sqrt(double(M));
+  };
+
+  // Batched solve into caller-provided storage
+  auto X    = array<double, 3>(NBATCH, N, NRHS);
+  auto errs = array<double, 1>(NBATCH);
+  auto work = matrix<double, F_layout>(lss.workspace_shape(NRHS));
+  lss.solve(B, X, errs, work);
+
+  for (long b = 0; b < NBATCH; ++b) {
+    auto Bb       = matrix<double>{B(b, _, _)};
+    auto [x, err] = lss(Bb);
+    EXPECT_ARRAY_NEAR(x, X(b, _, _), 1e-14);
+    EXPECT_NEAR(err, errs(b), 1e-14);
+    EXPECT_NEAR(err, max_residual(Bb, x), 1e-12);
+
+    // The least square solution : the residual is orthogonal to the columns of A
+    EXPECT_ARRAY_NEAR(matrix<double>{transpose(A) * (A * x - Bb)}, matrix<double>::zeros({N, NRHS}), 1e-12);
+  }
+
+  // Square systems have no error
+  auto A2       = matrix<double>{{2, 1}, {1, 3}};
+  auto [x2, e2] = lapack::gelss_worker<double>{A2}(matrix<double>{{3}, {4}});
+  EXPECT_ARRAY_NEAR(x2, matrix<double>{{1}, {1}}, 1e-14);
+  EXPECT_EQ(e2, 0.0);
+}
+
 // =================================== getrs =======================================
 
 TEST(lapack, getrs) { //NOLINT
@@ -191,3 +286,59 @@ TEST(lapack, getrs) { //NOLINT
 
   EXPECT_ARRAY_NEAR(X1, X2);
 }
+
+// =================================== potrf, potrs, potri =======================================
+
+TEST(lapack, potrs) { //NOLINT
+
+  using matrix_t = matrix<double, F_layout>;
+
+  auto A = matrix_t{{4, 2, 2}, {2, 5, 3}, {2, 3, 6}};
+  auto B = matrix_t{{1, 5}, {4, 5}, {3, 6}};
+
+  // Solve A * x = B using potrf,potrs
+  auto Acopy = matrix_t{A};
+  auto X     = matrix_t{B};
+  int info   = lapack::potrf(Acopy);
+  EXPECT_EQ(info, 0);
+  info = lapack::potrs(Acopy, X);
+  EXPECT_EQ(info, 0);
+  EXPECT_ARRAY_NEAR(matrix_t{A * X}, B);
+
+  // Inverse using potri : only the upper triangle is computed
+  info = lapack::potri(Acopy);
+  EXPECT_EQ(info, 0);
+  auto Ainv = inverse(A);
+  for (int i = 0; i < 3; ++i)
+    for (int j = i; j < 3; ++j) EXPECT_NEAR(Acopy(i, j), Ainv(i, j), 1.e-14);
+
+  // Not positive definite
+  auto M = matrix_t{-A};
+  EXPECT_GT(lapack::potrf(M), 0);
+}
+
+// =================================== gesv_mixed =======================================
+
+template <typename T>
+void test_gesv_mixed() {
+
+  using matrix_t = matrix<T, F_layout>;
+
+  auto A = matrix_t{{1, 2, 3}, {0, 1, 4}, {5, 6, 0}};
+  auto B = matrix_t{{1, 5}, {4, 5}, {3, 6}};
+  if constexpr (nda::is_complex_v<T>) A(0, 1) += 1i;
+
+  // Factorization in single precision, refinement to double precision
+  auto Acopy = matrix_t{A};
+  auto X     = matrix_t(3, 2);
+  int iter   = 0;
+  int info   = lapack::gesv_mixed(Acopy, B, X, iter);
+  EXPECT_EQ(info, 0);
+  EXPECT_ARRAY_NEAR(matrix_t{A * X}, B, 1.e-13);
+  EXPECT_ARRAY_NEAR(X, matrix_t{inverse(A) * B}, 1.e-12);
+}
+
+TEST(lapack, gesv_mixed) { //NOLINT
+  test_gesv_mixed<double>();
+  test_gesv_mixed<dcomplex>();
+}
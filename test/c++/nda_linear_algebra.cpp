@@ -21,6 +21,10 @@
 
 #include <nda/linalg/det_and_inverse.hpp>
 #include <nda/linalg/eigenelements.hpp>
+#include <nda/linalg/lu_factorization.hpp>
+#include <nda/linalg/cholesky_factorization.hpp>
+#include <nda/linalg/matmul_chain.hpp>
+#include <nda/linalg/svd.hpp>
 
 using nda::C_layout;
 using nda::F_layout;
@@ -108,12 +112,58 @@ TEST(Matmul, Double) { // NOLINT
 TEST(Matmul, Complex) { // NOLINT
   all_test_matmul<std::complex<double>>();
 }
+TEST(Matmul, Float) { // NOLINT
+  all_test_matmul<float>();
+}
+TEST(Matmul, ComplexFloat) { // NOLINT
+  all_test_matmul<std::complex<float>>();
+}
 TEST(Matmul, Int) { // NOLINT
   all_test_matmul<long>();
 }
 
 //-------------------------------------------------------------
 
+TEST(Matmul, GenericBlocked) { //NOLINT
+  // Sizes not multiple of the block sizes, and K larger than one k block
+  long M = 67, K = 300, N = 35;
+  matrix<long> A(M, K), B(K, N);
+  for (int i = 0; i < M; ++i)
+    for (int k = 0; k < K; ++k) A(i, k) = (i * 7 + k * 3) % 11 - 5;
+  for (int k = 0; k < K; ++k)
+    for (int j = 0; j < N; ++j) B(k, j) = (k * 5 + j) % 13 - 6;
+
+  matrix<long> C_exact(M, N);
+  for (int i = 0; i < M; ++i)
+    for (int j = 0; j < N; ++j) {
+      long acc = 0;
+      for (int k = 0; k < K; ++k) acc += A(i, k) * B(k, j);
+      C_exact(i, j) = acc;
+    }
+
+  EXPECT_EQ(matrix<long>{A * B}, C_exact);
+
+  // alpha and beta != 0
+  matrix<long> C(M, N), C2(M, N);
+  C()  = 1;
+  C2() = 3;
+  blas::gemm_generic(2, A, B, 3, C);
+  EXPECT_EQ(C, matrix<long>{2 * C_exact + C2});
+
+  // Transposed views, strided views, lazy expressions and a Fortran ordered output
+  matrix<long> At = transpose(A);
+  matrix<long, F_layout> CF(M, N);
+  blas::gemm_generic(1, transpose(At), B, 0, CF);
+  EXPECT_EQ(matrix<long>{CF}, C_exact);
+
+  matrix<long> B2(K, 2 * N);
+  B2(_, range(0, 2 * N, 2)) = B;
+  blas::gemm_generic(1, A + A, B2(_, range(0, 2 * N, 2)), 0, CF);
+  EXPECT_EQ(matrix<long>{CF}, 2 * C_exact);
+}
+
+//-------------------------------------------------------------
+
 TEST(Matmul, Promotion) { //NOLINT
   matrix<double> C, D, A = {{1.0, 2.3}, {3.1, 4.3}};
   matrix<int> B     = {{1, 2}, {3, 4}};
@@ -126,6 +176,67 @@ TEST(Matmul, Promotion) { //NOLINT
 
 //-------------------------------------------------------------
 
+TEST(Matmul, Into) { //NOLINT
+  matrix<double> A = {{1.0, 2.3}, {3.1, 4.3}, {-1, 0.5}};
+  matrix<int> B    = {{1, 2, 0}, {3, 4, 1}};
+  matrix<double> C;
+
+  // The result is resized once, then its storage is reused
+  matmul_into(C, A, B);
+  EXPECT_ARRAY_NEAR(C, A * B, 1.e-13);
+  auto *p = C.data();
+  for (int i = 0; i < 3; ++i) {
+    matmul_into(C, A + double(i), B);
+    EXPECT_EQ(C.data(), p);
+    EXPECT_ARRAY_NEAR(C, (A + double(i)) * B, 1.e-13);
+  }
+
+  // Into a view, with the correct shape
+  matrix<double> D(6, 6);
+  D() = 0;
+  matmul_into(D(range(0, 6, 2), range(0, 6, 2)), A, B);
+  EXPECT_ARRAY_NEAR(D(range(0, 6, 2), range(0, 6, 2)), A * B, 1.e-13);
+  EXPECT_ARRAY_NEAR(D(range(1, 6, 2), _), matrix<double>::zeros({3, 6}));
+
+  // Matrix vector product
+  nda::array<double, 1> x = {1, -2, 0.5}, y;
+  matvecmul_into(y, C, x);
+  EXPECT_ARRAY_NEAR(y, matvecmul(C, x), 1.e-13);
+  auto *py = y.data();
+  matvecmul_into(y, 2 * C, x);
+  EXPECT_EQ(y.data(), py);
+  EXPECT_ARRAY_NEAR(y, 2 * matvecmul(C, x), 1.e-13);
+}
+
+//-------------------------------------------------------------
+
+TEST(Matmul, ChainOrder) { //NOLINT
+  // (10 x 100) (100 x 5) (5 x 50) : ((A B) C) costs 7500, (A (B C)) costs 75000
+  auto split = nda::details::matrix_chain_order<3>(std::array<long, 4>{10, 100, 5, 50});
+  EXPECT_EQ(split[0][2], 1);
+  EXPECT_EQ(split[0][1], 0);
+
+  // (50 x 5) (5 x 100) (100 x 10) : right to left is cheaper
+  split = nda::details::matrix_chain_order<3>(std::array<long, 4>{50, 5, 100, 10});
+  EXPECT_EQ(split[0][2], 0);
+}
+
+TEST(Matmul, Chain) { //NOLINT
+  auto U = matrix<dcomplex>(nda::rand<double>(20, 4));
+  auto M = matrix<double>(nda::rand<double>(20, 20));
+  auto v = nda::array<double, 1>(nda::rand<double>(4));
+  matrix<dcomplex> U2 = dagger(U);
+
+  // dagger(U) * M * U * v, best evaluated right to left, with an expression and mixed value types
+  nda::array<dcomplex, 1> x = matvecmul(matrix<dcomplex>{dagger(U) * M * U}, v);
+  EXPECT_ARRAY_NEAR(matmul_chain(dagger(U), M, U, v), x, 1.e-12);
+  EXPECT_ARRAY_NEAR(matmul_chain(U2, M, U), dagger(U) * M * U, 1.e-12);
+  EXPECT_ARRAY_NEAR(matmul_chain(U, U2, M, U, U2), U * U2 * M * U * U2, 1.e-12);
+  EXPECT_ARRAY_NEAR(matmul_chain(M, M), M * M, 1.e-12);
+}
+
+//-------------------------------------------------------------
+
 TEST(Matmul, Cache) { //NOLINT
   // testing with view for possible cache issue
 
@@ -306,6 +417,125 @@ TEST(Inverse, slice) { //NOLINT
   }
 }
 
+//-------------------------------------------------------------
+
+template <typename T, typename L>
+void test_lu_factorization() {
+
+  // Single precision results are only checked to float accuracy
+  double const prec = (std::is_same_v<nda::blas::real_value_t<T>, float> ? 1.e-4 : 1.e-12);
+
+  matrix<T, L> W(3, 3);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) W(i, j) = (i > j ? i + 2.5 * j : i * 0.8 - j);
+  if constexpr (nda::is_complex_v<T>) W(0, 1) += 1i;
+
+  auto lu = nda::linalg::lu_factorization<T, L>{W};
+  EXPECT_COMPLEX_NEAR(lu.determinant(), determinant(W), prec);
+
+  // Vector, strided vector, matrices in both orders and a batch of matrices
+  nda::array<T, 1> b = {1, 2, 3};
+  auto x             = lu.solve(b);
+  EXPECT_ARRAY_NEAR(matvecmul(W, x), b, prec);
+
+  nda::array<T, 1> b2(6);
+  b2(range(0, 6, 2)) = b;
+  lu.solve_in_place(b2(range(0, 6, 2)));
+  EXPECT_ARRAY_NEAR(b2(range(0, 6, 2)), x, prec);
+
+  matrix<T, C_layout> B = {{1, 5}, {4, 5}, {3, 6}};
+  matrix<T, F_layout> X = lu.solve(B);
+  EXPECT_ARRAY_NEAR(matrix<T>{W * X}, B, prec);
+
+  matrix<T, C_layout> XC = B;
+  lu.solve_in_place(XC);
+  EXPECT_ARRAY_NEAR(XC, X, prec);
+
+  nda::array<T, 3> batch(4, 3, 2);
+  for (int k = 0; k < 4; ++k) batch(k, _, _) = (k + 1) * B;
+  lu.solve_in_place(batch);
+  for (int k = 0; k < 4; ++k) EXPECT_ARRAY_NEAR(batch(k, _, _), (k + 1) * X, prec);
+
+  // 1-norm condition number, compared to the explicit inverse
+  auto norm1 = [](auto const &m) {
+    double r = 0;
+    for (int j = 0; j < m.extent(1); ++j) r = std::max(r, double(sum(abs(m(_, j)))));
+    return r;
+  };
+  EXPECT_NEAR(1.0 / lu.rcond(), norm1(W) * norm1(inverse(W)), 100 * prec);
+
+  // Refactorize and in place variant
+  lu.factorize(matrix<T, L>{2 * W});
+  EXPECT_ARRAY_NEAR(lu.solve(b), x / 2, prec);
+  auto lu2 = nda::linalg::lu_factorization{matrix<T, L>{W}};
+  EXPECT_ARRAY_NEAR(lu2.solve(b), x, prec);
+
+  // Singular matrix
+  W(_, 1) = 0;
+  auto lu3 = nda::linalg::lu_factorization<T, L>{W};
+  EXPECT_TRUE(lu3.is_singular());
+  EXPECT_EQ(lu3.rcond(), 0.0);
+  EXPECT_THROW(lu3.solve(b), nda::runtime_error);
+}
+
+TEST(LU, Factorization) { //NOLINT
+  test_lu_factorization<double, F_layout>();
+  test_lu_factorization<double, C_layout>();
+  test_lu_factorization<dcomplex, F_layout>();
+  test_lu_factorization<dcomplex, C_layout>();
+  test_lu_factorization<float, F_layout>();
+  test_lu_factorization<float, C_layout>();
+  test_lu_factorization<std::complex<float>, F_layout>();
+  test_lu_factorization<std::complex<float>, C_layout>();
+}
+
+//-------------------------------------------------------------
+
+template <typename T, typename L>
+void test_cholesky_factorization() {
+
+  // A = M^H M + 1 is positive definite
+  matrix<T, L> M = {{1, 2, 3}, {0, 1, 4}, {5, 6, 0}};
+  if constexpr (nda::is_complex_v<T>) M(0, 1) += 2i;
+  matrix<T, L> A = dagger(M) * M + nda::eye<T>(3);
+
+  auto chol = nda::linalg::cholesky_factorization<T, L>{A};
+  EXPECT_TRUE(chol.is_positive_definite());
+  EXPECT_NEAR(chol.determinant(), std::real(determinant(A)), 1.e-9);
+  EXPECT_NEAR(chol.log_determinant(), std::log(std::real(determinant(A))), 1.e-12);
+  EXPECT_ARRAY_NEAR(chol.inverse(), inverse(A), 1.e-12);
+
+  nda::array<T, 1> b = {1, 2, 3};
+  if constexpr (nda::is_complex_v<T>) b(2) = 3i;
+  auto x = chol.solve(b);
+  EXPECT_ARRAY_NEAR(matvecmul(A, x), b, 1.e-12);
+
+  matrix<T, C_layout> B = {{1, 5}, {4, 5}, {3, 6}};
+  matrix<T, C_layout> X = B;
+  chol.solve_in_place(X);
+  EXPECT_ARRAY_NEAR(matrix<T>{A * X}, B, 1.e-12);
+  EXPECT_ARRAY_NEAR(chol.solve(B), X, 1.e-12);
+
+  // Same result as the LU path
+  EXPECT_ARRAY_NEAR(nda::linalg::lu_factorization{A}.solve(B), X, 1.e-12);
+
+  // In place variant
+  auto chol2 = nda::linalg::cholesky_factorization{matrix<T, L>{A}};
+  EXPECT_ARRAY_NEAR(chol2.solve(b), x, 1.e-12);
+
+  // Not positive definite
+  auto chol3 = nda::linalg::cholesky_factorization<T, L>{-A};
+  EXPECT_FALSE(chol3.is_positive_definite());
+  EXPECT_THROW(chol3.solve(b), nda::runtime_error);
+}
+
+TEST(Cholesky, Factorization) { //NOLINT
+  test_cholesky_factorization<double, F_layout>();
+  test_cholesky_factorization<double, C_layout>();
+  test_cholesky_factorization<dcomplex, F_layout>();
+  test_cholesky_factorization<dcomplex, C_layout>();
+}
+
 // ==============================================================
 
 TEST(Matvecmul, Promotion) { //NOLINT
@@ -400,3 +630,69 @@ TEST(eigenelements, test1) { //NOLINT
     test(C);
   }
 }
+
+//----------------------------------
+
+TEST(eigenelements, in_place) { //NOLINT
+
+  auto test = [](auto M) {
+    auto Mcopy = M;
+    auto ev    = nda::linalg::eigenelements_in_place(Mcopy);
+    check_eig(M, Mcopy, ev);
+
+    // Eigenvectors written into a caller-supplied buffer of either memory order
+    matrix<typename decltype(M)::value_type, C_layout> vecs_c(M.shape());
+    matrix<typename decltype(M)::value_type, F_layout> vecs_f(M.shape());
+    auto ev_c = nda::linalg::eigenelements(M, vecs_c);
+    auto ev_f = nda::linalg::eigenelements(M, vecs_f);
+    check_eig(M, vecs_c, ev_c);
+    check_eig(M, vecs_f, ev_f);
+    EXPECT_ARRAY_NEAR(ev_c, ev);
+    EXPECT_ARRAY_NEAR(ev_f, ev);
+
+    auto Mcopy2 = M;
+    EXPECT_ARRAY_NEAR(nda::linalg::eigenvalues_in_place(Mcopy2), ev);
+  };
+
+  matrix<dcomplex> H{{1.3, 1.1i, 0.2 - 0.4i}, {-1.1i, 2.4, 0.7}, {0.2 + 0.4i, 0.7, -0.5}};
+  test(H);
+  test(matrix<dcomplex, F_layout>{H});
+  test(matrix<double>{real(H + dagger(H))});
+  test(matrix<double, F_layout>{real(H + dagger(H))});
+}
+
+// ==============================================================
+
+TEST(SVD, ThinAndFull) { //NOLINT
+
+  auto test = [](auto A) {
+    using T = typename decltype(A)::value_type;
+    long M = A.extent(0), N = A.extent(1), K = std::min(M, N);
+
+    // Thin
+    auto [U, S, VT] = nda::linalg::svd(A);
+    EXPECT_EQ(U.shape(), (std::array<long, 2>{M, K}));
+    EXPECT_EQ(VT.shape(), (std::array<long, 2>{K, N}));
+    auto S_mat = matrix<T>::zeros({K, K});
+    for (long i = 0; i < K; ++i) S_mat(i, i) = S(i);
+    EXPECT_ARRAY_NEAR(A, matrix<T>{U * S_mat * VT}, 1e-13);
+    EXPECT_ARRAY_NEAR(matrix<T>{dagger(U) * U}, nda::eye<T>(K), 1e-13);
+    for (long i = 1; i < K; ++i) EXPECT_LE(S(i), S(i - 1));
+
+    // Full
+    auto [Uf, Sf, VTf] = nda::linalg::svd(A, true);
+    EXPECT_EQ(Uf.shape(), (std::array<long, 2>{M, M}));
+    EXPECT_EQ(VTf.shape(), (std::array<long, 2>{N, N}));
+    EXPECT_ARRAY_NEAR(matrix<T>{dagger(Uf) * Uf}, nda::eye<T>(M), 1e-13);
+    EXPECT_ARRAY_NEAR(Sf, S, 1e-13);
+
+    // Values only
+    EXPECT_ARRAY_NEAR(nda::linalg::singular_values(A), S, 1e-13);
+  };
+
+  matrix<dcomplex> H{{1.3, 1.1i, 0.2 - 0.4i}, {-1.1i, 2.4, 0.7}, {0.2 + 0.4i, 0.7, -0.5}, {1, 2, 3}};
+  test(H);
+  test(matrix<dcomplex, F_layout>{transpose(H)});
+  test(matrix<double>{real(H)});
+  test(matrix<double, F_layout>{real(transpose(H))});
+}
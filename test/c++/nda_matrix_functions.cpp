@@ -0,0 +1,115 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// ==============================================================
+
+TEST(Expm, Simple) { //NOLINT
+  // Diagonal
+  auto d = nda::matrix<double>{{1, 0}, {0, -2}};
+  EXPECT_ARRAY_NEAR(nda::linalg::expm(d), (nda::matrix<double>{{std::exp(1.0), 0}, {0, std::exp(-2.0)}}), 1.e-14);
+
+  // Nilpotent
+  auto a = nda::matrix<double>{{0, 3}, {0, 0}};
+  EXPECT_ARRAY_NEAR(nda::linalg::expm(a), (nda::matrix<double>{{1, 3}, {0, 1}}), 1.e-14);
+
+  // Rotations, for small and large angles, i.e. through all the Pade approximants and with squaring
+  for (double t : {1.e-3, 0.1, 0.5, 1.5, 3.0, 20.0, 1000.0}) {
+    auto r = nda::matrix<double>{{0, -t}, {t, 0}};
+    EXPECT_ARRAY_NEAR(nda::linalg::expm(r), (nda::matrix<double>{{std::cos(t), -std::sin(t)}, {std::sin(t), std::cos(t)}}), 1.e-11 * (1 + t));
+  }
+
+  // Empty
+  EXPECT_EQ(nda::linalg::expm(nda::matrix<double>(0, 0)).size(), 0);
+}
+
+template <typename T>
+void test_expm_general(long n, double scale) {
+  // A non normal matrix
+  auto a = nda::matrix<T>{scale * make_test_matrix<T>(n, n)};
+
+  auto e  = nda::linalg::expm(a);
+  auto em = nda::linalg::expm(nda::matrix<T>{-a});
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{e * em}, nda::eye<T>(n), 1.e-10);
+
+  // exp(a) commutes with a
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{e * a}, nda::matrix<T>{a * e}, 1.e-10 * nda::max_element(nda::abs(e)));
+}
+
+TEST(Expm, General) { //NOLINT
+  for (double scale : {0.001, 0.05, 0.3, 2.0}) {
+    test_expm_general<double>(6, scale);
+    test_expm_general<dcomplex>(6, scale);
+  }
+}
+
+TEST(Expm, Hermitian) { //NOLINT
+  long n = 8;
+  auto h = nda::matrix<dcomplex>{make_test_hermitian<dcomplex>(n) / double(n)};
+
+  // The fast path agrees with scaling and squaring
+  EXPECT_ARRAY_NEAR(nda::linalg::expm_hermitian(h), nda::linalg::expm(h), 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::linalg::expm_hermitian(h, 3.0), nda::linalg::expm(nda::matrix<dcomplex>{3.0 * h}), 1.e-11);
+
+  // Time propagation : exp(-i H dt) is unitary
+  double dt = 0.7;
+  auto u    = nda::linalg::expm_hermitian(h, dcomplex{0, -dt});
+  EXPECT_ARRAY_NEAR(u, nda::linalg::expm(nda::matrix<dcomplex>{dcomplex{0, -dt} * h}), 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>{u * nda::dagger(u)}, nda::eye<dcomplex>(n), 1.e-12);
+
+  // A real symmetric matrix with a complex factor gives a complex result
+  auto hr = nda::matrix<double>{make_test_hermitian<double>(n) / double(n)};
+  auto ur = nda::linalg::expm_hermitian(hr, dcomplex{0, -dt});
+  static_assert(std::is_same_v<nda::get_value_t<decltype(ur)>, dcomplex>);
+  EXPECT_ARRAY_NEAR(ur, nda::linalg::expm(nda::matrix<dcomplex>{dcomplex{0, -dt} * hr}), 1.e-12);
+}
+
+template <typename T>
+void test_hermitian_functions() {
+  long n = 7;
+  auto h = nda::matrix<T>{make_test_hermitian<T>(n, 2.0 * n) / double(n)};
+
+  // One eigendecomposition, several functions
+  auto es = nda::linalg::hermitian_eigensystem{h};
+  EXPECT_EQ(es.dim(), n);
+  auto s = es.sqrt();
+  auto l = es.log();
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{s * s}, h, 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::linalg::expm(l), h, 1.e-12);
+  EXPECT_ARRAY_NEAR(es.exp(), nda::linalg::expm(h), 1.e-12);
+  EXPECT_ARRAY_NEAR(es.apply([](double x) { return 1 / x; }), nda::inverse(h), 1.e-12);
+  EXPECT_ARRAY_NEAR(es.apply([](double x) { return x; }), h, 1.e-13);
+
+  // Free functions
+  EXPECT_ARRAY_NEAR(nda::linalg::sqrtm_hermitian(h), s, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::linalg::logm_hermitian(h), l, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::linalg::funm_hermitian(h, [](double x) { return x * x; }), nda::matrix<T>{h * h}, 1.e-12);
+
+  // logm_hermitian of expm_hermitian
+  auto h0 = nda::matrix<T>{make_test_hermitian<T>(n) / double(n)};
+  EXPECT_ARRAY_NEAR(nda::linalg::logm_hermitian(nda::linalg::expm_hermitian(h0)), h0, 1.e-12);
+
+  // Not positive definite
+  auto neg = nda::matrix<T>{-h};
+  EXPECT_THROW(nda::linalg::sqrtm_hermitian(neg), nda::runtime_error); //NOLINT
+  EXPECT_THROW(nda::linalg::logm_hermitian(neg), nda::runtime_error);  //NOLINT
+}
+
+TEST(MatrixFunctions, Hermitian) { //NOLINT
+  test_hermitian_functions<double>();
+  test_hermitian_functions<dcomplex>();
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// ==============================================================
+
+TEST(Packed, IdxMap) { //NOLINT
+  auto up = nda::packed_idx_map{4, 'U'};
+  auto lo = nda::packed_idx_map{4, 'L'};
+  EXPECT_EQ(up.size(), 10);
+  EXPECT_EQ(nda::packed_idx_map::dim_from_size(10), 4);
+
+  // Each stored element has a distinct position, column by column
+  long k_up = 0, k_lo = 0;
+  for (long j = 0; j < 4; ++j)
+    for (long i = 0; i < 4; ++i) {
+      if (i <= j) { EXPECT_EQ(up(i, j), k_up++); }
+      if (i >= j) { EXPECT_EQ(lo(i, j), k_lo++); }
+    }
+}
+
+// ==============================================================
+
+template <typename T>
+void test_packed() {
+  long n = 6;
+  auto M = make_test_hermitian<T>(n);
+  auto A = nda::packed_matrix<T>{M};
+
+  EXPECT_EQ(A.data().size(), n * (n + 1) / 2);
+  EXPECT_ARRAY_NEAR(A.to_dense(), M, 1.e-15);
+  EXPECT_COMPLEX_NEAR(A(4, 1), M(4, 1), 1.e-15);
+
+  // Products
+  auto x = nda::vector<T>(n);
+  for (long i = 0; i < n; ++i) x(i) = 1.0 / (i + 2);
+  EXPECT_ARRAY_NEAR(A * x, M * x, 1.e-14);
+  auto X = nda::matrix<T>(n, 3);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < 3; ++j) X(i, j) = i - 2.0 * j;
+  EXPECT_ARRAY_NEAR(A * X, M * X, 1.e-13);
+
+  // blas::spmv with strided vectors and beta, on the lower triangle
+  auto lo = nda::packed_idx_map{n, 'L'};
+  auto ap = nda::array<T, 1>(lo.size());
+  for (long j = 0; j < n; ++j)
+    for (long i = j; i < n; ++i) ap(lo(i, j)) = M(i, j);
+  auto y  = nda::vector<T>(2 * n);
+  y       = 1;
+  auto y0 = y;
+  nda::blas::spmv(T{2}, ap, x, T{-1}, y(range(0, 2 * n, 2)), 'L');
+  EXPECT_ARRAY_NEAR(y(range(0, 2 * n, 2)), nda::vector<T>{2 * M * x - y0(range(0, 2 * n, 2))}, 1.e-14);
+
+  // Rank 1 update
+  A.rank1_update(0.5, x);
+  auto xx = nda::matrix<T>(n, n);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < n; ++j) xx(i, j) = x(i) * nda::conj(x(j));
+  EXPECT_ARRAY_NEAR(A.to_dense(), M + 0.5 * xx, 1.e-14);
+  A = nda::packed_matrix<T>{M};
+
+  // Eigenelements
+  auto [ev, vecs] = nda::linalg::eigenelements(A);
+  EXPECT_ARRAY_NEAR(ev, nda::linalg::eigenvalues(M), 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::linalg::eigenvalues(A), ev, 1.e-13);
+  EXPECT_ARRAY_NEAR(M * vecs, vecs * nda::diag(ev), 1.e-13);
+
+  // Solve (the matrix is indefinite in general)
+  auto B = nda::matrix<T>{M * X};
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(A, B), X, 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(A, M * x), x, 1.e-12);
+}
+
+TEST(Packed, Double) { test_packed<double>(); }    //NOLINT
+TEST(Packed, Complex) { test_packed<dcomplex>(); } //NOLINT
+
+TEST(Packed, Indefinite) { //NOLINT
+  nda::matrix<double> M = {{0, 1, 2}, {1, 0, 3}, {2, 3, 0}};
+  auto A                = nda::packed_matrix<double>{M};
+  nda::vector<double> x = {1, -2, 3};
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(A, M * x), x, 1.e-13);
+}
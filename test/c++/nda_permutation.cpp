@@ -103,3 +103,41 @@ PRINT(v.iterator_rank);
           for (int l = 0; l < v.extent(3); ++l) { EXPECT_EQ(v(i, j, k, l), (*it++)); }
   }
 }
+
+// ---------------------------------------------
+TEST(Permutation, TransposeCopy) { //NOLINT
+
+  // Sizes larger than and not multiple of the tile
+  nda::array<long, 4> a(37, 3, 70, 2);
+  for (auto [i, j, k, l] : a.indices()) a(i, j, k, l) = 1 + i + 100 * j + 1000 * k + 100000 * l;
+
+  auto check = [&a](auto const &b, auto const &perm_index) {
+    for (auto [i, j, k, l] : a.indices()) EXPECT_EQ(a(i, j, k, l), perm_index(b, i, j, k, l));
+  };
+
+  // make_regular, construction and assignment of a permuted view
+  auto v = nda::rotate_index_view<2>(a);
+  auto b = nda::make_regular(v);
+  check(b, [](auto const &x, long i, long j, long k, long l) { return x(k, i, j, l); });
+
+  nda::array<long, 4> c(v.shape());
+  c = v;
+  EXPECT_EQ(b, c);
+
+  // Between two views with different stride orders, and a strided view
+  nda::array<long, 4, nda::F_layout> f(a.shape());
+  f = a;
+  check(f, [](auto const &x, long i, long j, long k, long l) { return x(i, j, k, l); });
+
+  nda::array<long, 4> g(37, 3, 140, 2);
+  g = 0;
+  g(_, _, range(0, 140, 2), _) = f;
+  check(g, [](auto const &x, long i, long j, long k, long l) { return x(i, j, 2 * k, l); });
+  EXPECT_EQ(g(_, _, range(1, 140, 2), _), nda::zeros<long>(37, 3, 70, 2));
+
+  // With scaling
+  nda::transpose_assign(2, v, 3, c);
+  EXPECT_EQ(c, 5 * b);
+  nda::transpose_assign(-1, v, 0, c);
+  EXPECT_EQ(c, -b);
+}
@@ -0,0 +1,144 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+template <typename M>
+void check_upper(M const &r) {
+  for (long i = 0; i < r.extent(0); ++i)
+    for (long j = 0; j < std::min(i, r.extent(1)); ++j) EXPECT_EQ(r(i, j), 0.0);
+}
+
+// ==============================================================
+
+template <typename T, typename Layout>
+void test_qr(long m, long n) {
+  auto A = make_test_matrix<T, Layout>(m, n);
+  long k = std::min(m, n);
+
+  for (bool thin : {true, false}) {
+    auto [Q, R] = nda::linalg::qr(A, thin);
+    long nq     = (thin ? k : m);
+    EXPECT_EQ(Q.shape(), (std::array<long, 2>{m, nq}));
+    EXPECT_EQ(R.shape(), (std::array<long, 2>{nq, n}));
+    EXPECT_ARRAY_NEAR(nda::matrix<T>{nda::dagger(Q) * Q}, nda::eye<T>(nq), 1.e-13);
+    EXPECT_ARRAY_NEAR(nda::matrix<T>{Q * R}, A, 1.e-13);
+    check_upper(R);
+  }
+}
+
+TEST(QR, Factorization) { //NOLINT
+  for (auto [m, n] : std::vector<std::pair<long, long>>{{7, 4}, {4, 7}, {5, 5}, {1, 3}, {3, 1}}) {
+    for_each_type_and_layout([m, n](auto t, auto l) { test_qr<decltype(t), decltype(l)>(m, n); });
+  }
+}
+
+template <typename T>
+void test_qr_pivoted() {
+  // Rank 3 matrix of 6 columns : the columns 3, 4, 5 are combinations of the columns 0, 1, 2
+  long m = 8, n = 6;
+  auto A = make_test_matrix<T>(m, n);
+  for (long i = 0; i < m; ++i) {
+    A(i, 3) = A(i, 0) + 2.0 * A(i, 1);
+    A(i, 4) = A(i, 2) - A(i, 0);
+    A(i, 5) = 0.5 * A(i, 1);
+  }
+
+  auto [Q, R, perm] = nda::linalg::qr_pivoted(A);
+  EXPECT_EQ(perm.size(), n);
+  auto Ap = nda::matrix<T>(m, n);
+  for (long j = 0; j < n; ++j) Ap(range::all, j) = A(range::all, perm(j));
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{Q * R}, Ap, 1.e-13);
+  check_upper(R);
+
+  // Decreasing diagonal, revealing the rank
+  for (long i = 1; i < n; ++i) EXPECT_LE(std::abs(R(i, i)), std::abs(R(i - 1, i - 1)) + 1.e-14);
+  EXPECT_GT(std::abs(R(2, 2)), 1.e-3);
+  EXPECT_LT(std::abs(R(3, 3)), 1.e-12 * std::abs(R(0, 0)));
+
+  // A permutation
+  auto sorted = perm;
+  std::sort(sorted.begin(), sorted.end());
+  for (long j = 0; j < n; ++j) EXPECT_EQ(sorted(j), j);
+}
+
+TEST(QR, Pivoted) { //NOLINT
+  test_qr_pivoted<double>();
+  test_qr_pivoted<dcomplex>();
+}
+
+template <typename T, typename Layout>
+void test_qr_in_place() {
+  long m = 9, n = 4;
+  auto A = make_test_matrix<T, Layout>(m, n);
+  auto Q = A;
+  auto R = nda::linalg::qr_in_place(Q);
+  EXPECT_EQ(R.shape(), (std::array<long, 2>{n, n}));
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{nda::dagger(Q) * Q}, nda::eye<T>(n), 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{Q * R}, A, 1.e-13);
+  check_upper(R);
+
+  // A strided view
+  auto B                            = nda::matrix<T, Layout>(m, 2 * n);
+  B(range::all, range(0, 2 * n, 2)) = A;
+  auto R2                           = nda::linalg::qr_in_place(B(range::all, range(0, 2 * n, 2)));
+  EXPECT_ARRAY_NEAR(B(range::all, range(0, 2 * n, 2)), Q, 1.e-13);
+  EXPECT_ARRAY_NEAR(R2, R, 1.e-13);
+}
+
+TEST(QR, InPlace) { //NOLINT
+  for_each_type_and_layout([](auto t, auto l) { test_qr_in_place<decltype(t), decltype(l)>(); });
+}
+
+template <typename T>
+void test_qr_batched() {
+  long nb = 5, m = 6, n = 3;
+  auto A = nda::array<T, 3>(nb, m, n);
+  for (long b = 0; b < nb; ++b) A(b, range::all, range::all) = make_test_matrix<T>(m, n, 0, b);
+
+  for (bool thin : {true, false}) {
+    auto [Q, R] = nda::linalg::qr_batched(A, thin);
+    for (long b = 0; b < nb; ++b) {
+      auto [Qb, Rb] = nda::linalg::qr(A(b, range::all, range::all), thin);
+      EXPECT_ARRAY_NEAR(Q(b, range::all, range::all), Qb, 1.e-14);
+      EXPECT_ARRAY_NEAR(R(b, range::all, range::all), Rb, 1.e-14);
+    }
+  }
+
+  auto Q = A;
+  auto R = nda::linalg::qr_in_place(Q);
+  EXPECT_EQ(R.shape(), (std::array<long, 3>{nb, n, n}));
+  for (long b = 0; b < nb; ++b) {
+    auto Qb = nda::matrix<T>{Q(b, range::all, range::all)};
+    EXPECT_ARRAY_NEAR(nda::matrix<T>{Qb * nda::matrix<T>{R(b, range::all, range::all)}}, A(b, range::all, range::all), 1.e-13);
+  }
+}
+
+TEST(QR, Batched) { //NOLINT
+  test_qr_batched<double>();
+  test_qr_batched<dcomplex>();
+}
+
+TEST(QR, Lapack) { //NOLINT
+  // geqrf + ungqr for complex
+  auto A   = make_test_matrix<dcomplex, nda::F_layout>(5, 3);
+  auto W   = A;
+  auto tau = nda::array<dcomplex, 1>{};
+  nda::lapack::geqrf(W, tau);
+  EXPECT_EQ(tau.size(), 3);
+  nda::lapack::ungqr(W, tau);
+  EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>{nda::dagger(W) * W}, nda::eye<dcomplex>(3), 1.e-13);
+}
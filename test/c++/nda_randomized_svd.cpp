@@ -0,0 +1,96 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// A M x N matrix with singular values decaying exponentially
+template <typename T, typename Layout = nda::C_layout>
+nda::matrix<T, Layout> make_decaying(long m, long n, double decay) {
+  auto r = nda::matrix<T, Layout>::zeros({m, n});
+  for (long i = 0; i < m; ++i)
+    for (long j = 0; j < n; ++j)
+      for (long l = 0; l < std::min(m, n); ++l) {
+        // smooth, non orthogonal "singular vectors"
+        auto x = std::cos((l + 1) * (i + 0.5) * M_PI / m) * std::cos((l + 1) * (j + 0.5) * M_PI / n);
+        if constexpr (nda::is_complex_v<T>)
+          r(i, j) += std::exp(-decay * l) * x * std::exp(dcomplex{0, 0.1 * l * (i - j)});
+        else
+          r(i, j) += std::exp(-decay * l) * x;
+      }
+  return r;
+}
+
+// ==============================================================
+
+template <typename T, typename Layout>
+void test_randomized_svd(long m, long n, long k) {
+  auto A     = make_decaying<T, Layout>(m, n, 1.0);
+  auto s_ref = nda::linalg::singular_values(A);
+
+  auto [U, S, VT] = nda::linalg::randomized_svd(A, k, 10, 2, 1234);
+  EXPECT_EQ(U.shape(), (std::array<long, 2>{m, k}));
+  EXPECT_EQ(S.size(), k);
+  EXPECT_EQ(VT.shape(), (std::array<long, 2>{k, n}));
+
+  // The top k singular values, relatively to the largest one
+  EXPECT_ARRAY_NEAR(S, s_ref(range(0, k)), 1.e-10 * s_ref(0));
+
+  // Orthonormal singular vectors
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{nda::dagger(U) * U}, nda::eye<T>(k), 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{VT * nda::dagger(VT)}, nda::eye<T>(k), 1.e-12);
+
+  // The error of the rank k approximation is of the order of the (k+1)-th singular value
+  auto S_mat = nda::matrix<T>::zeros({k, k});
+  for (long i = 0; i < k; ++i) S_mat(i, i) = S(i);
+  auto err = nda::linalg::singular_values(nda::matrix<T>{A - U * S_mat * VT});
+  EXPECT_LT(err(0), 1.e-8 + 10 * s_ref(k));
+
+  // The range finder
+  auto Q = nda::linalg::randomized_range_finder(A, k + 5, 2, 1);
+  EXPECT_ARRAY_NEAR(nda::matrix<T>{nda::dagger(Q) * Q}, nda::eye<T>(k + 5), 1.e-12);
+  EXPECT_LT(nda::linalg::singular_values(nda::matrix<T>{A - Q * (nda::dagger(Q) * A)})(0), 1.e-8 + 10 * s_ref(k + 5));
+}
+
+TEST(RandomizedSVD, Accuracy) { //NOLINT
+  test_randomized_svd<double, nda::C_layout>(60, 40, 8);
+  test_randomized_svd<double, nda::F_layout>(40, 60, 8);
+  test_randomized_svd<dcomplex, nda::C_layout>(50, 45, 6);
+  test_randomized_svd<dcomplex, nda::F_layout>(45, 50, 6);
+}
+
+TEST(RandomizedSVD, Seed) { //NOLINT
+  auto A            = make_decaying<double>(40, 30, 0.5);
+  auto [U1, S1, V1] = nda::linalg::randomized_svd(A, 5, 5, 1, 42);
+  auto [U2, S2, V2] = nda::linalg::randomized_svd(A, 5, 5, 1, 42);
+  EXPECT_EQ(U1, U2);
+  EXPECT_EQ(S1, S2);
+  EXPECT_EQ(V1, V2);
+}
+
+TEST(RandomizedSVD, ViewsAndExpressions) { //NOLINT
+  auto A   = make_decaying<double>(50, 40, 1.0);
+  auto ref = std::get<1>(nda::linalg::randomized_svd(A, 4, 10, 2, 7));
+
+  // A non contiguous view, and a lazy expression
+  auto B = nda::matrix<double>(100, 40);
+  B(range(0, 100, 2), range::all) = A;
+  EXPECT_ARRAY_NEAR(std::get<1>(nda::linalg::randomized_svd(B(range(0, 100, 2), range::all), 4, 10, 2, 7)), ref, 1.e-12);
+  EXPECT_ARRAY_NEAR(std::get<1>(nda::linalg::randomized_svd(2 * A, 4, 10, 2, 7)), nda::array<double, 1>{2 * ref}, 1.e-12);
+
+  // k = min(M, N) : exact
+  auto C = make_decaying<double>(8, 6, 0.3);
+  EXPECT_ARRAY_NEAR(std::get<1>(nda::linalg::randomized_svd(C, 6, 10, 0)), nda::linalg::singular_values(C), 1.e-12);
+}
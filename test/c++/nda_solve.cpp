@@ -0,0 +1,131 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+using nda::linalg::solve_strategy;
+
+// Keep only the elements (i, j) of a such that keep(i, j)
+template <typename M, typename F>
+M restrict_to(M a, F keep) {
+  for (long i = 0; i < a.extent(0); ++i)
+    for (long j = 0; j < a.extent(1); ++j)
+      if (not keep(i, j)) a(i, j) = 0;
+  return a;
+}
+
+// Solve with the detected strategy, and check the detection and the residual
+template <typename M>
+void check_solve(M const &a, solve_strategy expected) {
+  using T = nda::get_value_t<M>;
+  long n  = a.extent(0);
+  EXPECT_EQ(nda::linalg::detect_solve_strategy(a), expected);
+
+  auto b = nda::matrix<T>(n, 3);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < 3; ++j) b(i, j) = 1.0 / (1.0 + i + j);
+  auto x = nda::linalg::solve(a, b);
+  EXPECT_ARRAY_NEAR(nda::matrix<T>(a * x), b, 1.e-12);
+
+  // same solution with the general path
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(a, b, solve_strategy::general), x, 1.e-12);
+
+  // vector right hand side
+  auto v = nda::vector<T>(b(range::all, 1));
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(a, v), x(range::all, 1), 1.e-12);
+}
+
+// ==============================================================
+
+template <typename T, typename Layout>
+void test_dispatch() {
+  long n = 6;
+  auto g = make_test_matrix<T, Layout>(n, n, 3.0);
+  check_solve(g, solve_strategy::general);
+  check_solve(restrict_to(g, [](long i, long j) { return i <= j; }), solve_strategy::upper_triangular);
+  check_solve(restrict_to(g, [](long i, long j) { return i >= j; }), solve_strategy::lower_triangular);
+  check_solve(restrict_to(g, [](long i, long j) { return std::abs(i - j) <= 1; }), solve_strategy::tridiagonal);
+  check_solve(make_test_hermitian<T, Layout>(n, 2.0 * n), solve_strategy::positive_definite);
+}
+
+TEST(Solve, Dispatch) { //NOLINT
+  for_each_type_and_layout([](auto t, auto l) { test_dispatch<decltype(t), decltype(l)>(); });
+}
+
+// --------------------------------------------------------------
+
+TEST(Solve, HermitianIndefinite) { //NOLINT
+  // hermitian with a positive diagonal, but not positive definite : the Cholesky attempt falls back to LU
+  auto a = nda::matrix<double>{{1, 2, 0.5}, {2, 1, 0.3}, {0.5, 0.3, 2}};
+  EXPECT_EQ(nda::linalg::detect_solve_strategy(a), solve_strategy::positive_definite);
+  auto b = nda::vector<double>{1, 2, 3};
+  auto x = nda::linalg::solve(a, b);
+  EXPECT_ARRAY_NEAR(nda::vector<double>(a * x), b, 1.e-12);
+}
+
+// --------------------------------------------------------------
+
+TEST(Solve, Hints) { //NOLINT
+  // with a hint, the elements outside of the structure are not referenced
+  long n   = 5;
+  auto g   = make_test_matrix<double, nda::F_layout>(n, n, 3.0);
+  auto b   = nda::vector<double>{1, -1, 2, 0.5, 3};
+  auto up  = restrict_to(g, [](long i, long j) { return i <= j; });
+  auto tri = restrict_to(g, [](long i, long j) { return std::abs(i - j) <= 1; });
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(g, b, solve_strategy::upper_triangular), nda::linalg::solve(up, b), 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(g, b, solve_strategy::tridiagonal), nda::linalg::solve(tri, b), 1.e-12);
+
+  auto pd = make_test_hermitian<double, nda::C_layout>(n, 2.0 * n);
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(pd, b, solve_strategy::positive_definite), nda::linalg::solve(pd, b, solve_strategy::general), 1.e-12);
+}
+
+// --------------------------------------------------------------
+
+TEST(Solve, InPlace) { //NOLINT
+  long n = 4;
+  auto a = make_test_matrix<dcomplex, nda::C_layout>(n, n, 3.0);
+
+  // b is a strided view of a larger matrix
+  auto big = nda::matrix<dcomplex>(n, 6);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < 6; ++j) big(i, j) = dcomplex(i + 1.0, j - 2.0);
+  auto ref = nda::matrix<dcomplex>(big(range::all, range(0, 6, 2)));
+  nda::linalg::solve_in_place(a, big(range::all, range(0, 6, 2)));
+  EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>(a * big(range::all, range(0, 6, 2))), ref, 1.e-12);
+  EXPECT_ARRAY_NEAR(big(range::all, 1), nda::vector<dcomplex>{{1, -1}, {2, -1}, {3, -1}, {4, -1}}, 1.e-15);
+
+  // a lazy expression and a strided view of a matrix
+  auto b = nda::vector<dcomplex>{1, 2, 3, 4};
+  auto x = nda::linalg::solve(2 * a, b);
+  EXPECT_ARRAY_NEAR(nda::vector<dcomplex>(2 * a * x), b, 1.e-12);
+
+  auto a2  = make_test_matrix<double, nda::F_layout>(2 * n, 2 * n, 3.0);
+  auto sub = a2(range(0, 2 * n, 2), range(0, 2 * n, 2));
+  auto up  = restrict_to(nda::matrix<double>(sub), [](long i, long j) { return i <= j; });
+  sub      = up;
+  auto bd  = nda::vector<double>{1, 2, 3, 4};
+  EXPECT_ARRAY_NEAR(nda::linalg::solve(sub, bd), nda::linalg::solve(up, bd, solve_strategy::general), 1.e-12);
+}
+
+// --------------------------------------------------------------
+
+TEST(Solve, Singular) { //NOLINT
+  auto b = nda::vector<double>{1, 2, 3};
+  EXPECT_THROW(nda::linalg::solve(nda::matrix<double>{{1, 2, 3}, {0, 0, 1}, {0, 0, 2}}, b), nda::runtime_error);
+  EXPECT_THROW(nda::linalg::solve(nda::matrix<double>{{1, 2, 3}, {2, 4, 6}, {1, 0, 1}}, b), nda::runtime_error);
+  EXPECT_THROW(nda::linalg::solve(nda::matrix<double>{{1, 1, 0, 0}, {1, 1, 0, 0}, {0, 1, 1, 1}, {0, 0, 1, 1}}, nda::vector<double>{1, 2, 3, 4}),
+               nda::runtime_error);
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+
+#include "./test_common.hpp"
+#include <nda/sparse.hpp>
+
+// ==============================================================
+
+TEST(Sparse, FromCOO) { //NOLINT
+  // Unordered triplets, with a duplicate entry (0, 1)
+  nda::array<long, 1> rows   = {2, 0, 0, 1, 0};
+  nda::array<long, 1> cols   = {3, 1, 0, 2, 1};
+  nda::array<double, 1> vals = {5, 1, 2, 3, 4};
+
+  auto A = nda::sparse::csr_matrix<double>::from_coo(3, 4, rows, cols, vals);
+  EXPECT_EQ(A.shape(), (std::array<long, 2>{3, 4}));
+  EXPECT_EQ(A.nnz(), 4);
+  EXPECT_EQ(A.row_ptr(), (nda::array<long, 1>{0, 2, 3, 4}));
+  EXPECT_EQ(A.col_idx(), (nda::array<long, 1>{0, 1, 2, 3}));
+
+  nda::matrix<double> D = {{2, 5, 0, 0}, {0, 0, 3, 0}, {0, 0, 0, 5}};
+  EXPECT_ARRAY_NEAR(A.to_dense(), D, 1.e-14);
+
+  // From dense, and back
+  auto B = nda::sparse::csr_matrix{D};
+  EXPECT_EQ(B.nnz(), 4);
+  EXPECT_EQ(B.row_ptr(), A.row_ptr());
+  EXPECT_EQ(B.col_idx(), A.col_idx());
+  EXPECT_ARRAY_NEAR(B.to_dense(), D, 1.e-14);
+
+  // Transpose
+  EXPECT_ARRAY_NEAR(A.transpose().to_dense(), transpose(D), 1.e-14);
+
+  // Empty rows, int indices
+  auto C = nda::sparse::csr_matrix<double, int>::from_coo(4, 2, rows(range(1, 2)), cols(range(1, 2)), vals(range(1, 2)));
+  EXPECT_EQ(C.row_ptr(), (nda::array<int, 1>{0, 1, 1, 1, 1}));
+}
+
+// ==============================================================
+
+// A random sparse matrix, together with its dense copy
+template <typename T>
+auto make_sparse(long n, long m, long nnz) {
+  auto rows = nda::array<long, 1>(nnz);
+  auto cols = nda::array<long, 1>(nnz);
+  auto vals = nda::array<T, 1>(nnz);
+  for (long k = 0; k < nnz; ++k) {
+    rows(k) = (k * 7919) % n;
+    cols(k) = (k * 104729 + k / 3) % m;
+    if constexpr (nda::is_complex_v<T>)
+      vals(k) = T{0.1 * (k % 13), -0.2 * (k % 5)};
+    else
+      vals(k) = 0.1 * (k % 13) - 0.5;
+  }
+  auto A = nda::sparse::csr_matrix<T>::from_coo(n, m, rows, cols, vals);
+
+  auto D = nda::matrix<T>::zeros({n, m});
+  for (long k = 0; k < nnz; ++k) D(rows(k), cols(k)) += vals(k);
+  return std::make_pair(A, D);
+}
+
+template <typename T>
+void test_spmv() {
+  auto [A, D] = make_sparse<T>(50, 30, 200);
+
+  auto x = nda::vector<T>(30);
+  auto z = nda::vector<T>(50);
+  for (long i = 0; i < 30; ++i) x(i) = 1.0 / (i + 1);
+  for (long i = 0; i < 50; ++i) z(i) = 0.5 * i;
+
+  // y = A x
+  auto y = nda::array<T, 1>(50);
+  nda::sparse::spmv(1, A, x, 0, y);
+  EXPECT_ARRAY_NEAR(y, nda::matrix<T>{D} * x, 1.e-13);
+
+  // y = 2 A x - y
+  auto y0 = y;
+  nda::sparse::spmv(2, A, x, -1, y);
+  EXPECT_ARRAY_NEAR(y, y0, 1.e-13);
+
+  // Transpose and adjoint
+  auto w = nda::array<T, 1>(30);
+  nda::sparse::spmv(1, A, z, 0, w, 'T');
+  EXPECT_ARRAY_NEAR(w, nda::matrix<T>{nda::transpose(D)} * z, 1.e-13);
+  nda::sparse::spmv(1, A, z, 0, w, 'C');
+  EXPECT_ARRAY_NEAR(w, nda::matrix<T>{nda::dagger(D)} * z, 1.e-13);
+
+  // Strided x and y
+  auto x2 = nda::array<T, 1>(60);
+  auto y2 = nda::array<T, 1>(100);
+  x2(range(0, 60, 2)) = x;
+  nda::sparse::spmv(1, A, x2(range(0, 60, 2)), 0, y2(range(1, 100, 2)));
+  EXPECT_ARRAY_NEAR(y2(range(1, 100, 2)), nda::matrix<T>{D} * x, 1.e-13);
+}
+
+TEST(Sparse, SpMV) { test_spmv<double>(); }   //NOLINT
+TEST(Sparse, SpMVC) { test_spmv<dcomplex>(); } //NOLINT
+
+// ==============================================================
+
+TEST(Sparse, SpMM) { //NOLINT
+  auto [A, D] = make_sparse<double>(40, 25, 150);
+
+  nda::matrix<double> X(25, 6), Z(40, 6);
+  for (long i = 0; i < 25; ++i)
+    for (long j = 0; j < 6; ++j) X(i, j) = std::sin(i + 3 * j);
+  for (long i = 0; i < 40; ++i)
+    for (long j = 0; j < 6; ++j) Z(i, j) = std::cos(i - j);
+
+  nda::matrix<double> Y(40, 6);
+  nda::sparse::spmm(1, A, X, 0, Y);
+  EXPECT_ARRAY_NEAR(Y, D * X, 1.e-13);
+
+  // Fortran ordered result, with beta
+  nda::matrix<double, nda::F_layout> Yf = Z;
+  nda::sparse::spmm(2, A, X, 1, Yf);
+  EXPECT_ARRAY_NEAR(Yf, 2 * D * X + Z, 1.e-13);
+
+  nda::matrix<double> W(25, 6);
+  nda::sparse::spmm(1, A, Z, 0, W, 'T');
+  EXPECT_ARRAY_NEAR(W, nda::matrix<double>{nda::transpose(D)} * Z, 1.e-13);
+}
+
+// ==============================================================
+
+TEST(Sparse, MatvecmulPlugin) { //NOLINT
+  auto [A, D] = make_sparse<double>(30, 30, 100);
+
+  nda::vector<double> x(30);
+  for (long i = 0; i < 30; ++i) x(i) = i - 10;
+
+  EXPECT_ARRAY_NEAR(nda::matvecmul(A, x), D * x, 1.e-13);
+  EXPECT_ARRAY_NEAR(A * x, D * x, 1.e-13);
+
+  // Lazy expression operand
+  EXPECT_ARRAY_NEAR(A * (2 * x), 2 * D * x, 1.e-13);
+
+  // matvecmul_into : the storage of the result is reused
+  nda::array<double, 1> y(30);
+  auto *p = y.data();
+  nda::matvecmul_into(y, A, x);
+  EXPECT_EQ(y.data(), p);
+  EXPECT_ARRAY_NEAR(y, D * x, 1.e-13);
+
+  // Sparse * dense matrix
+  nda::matrix<double> X = D;
+  EXPECT_ARRAY_NEAR(A * X, D * D, 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::matmul(A, X), D * D, 1.e-12);
+
+  // Generic code written for dense matrices runs unchanged : a few power iterations
+  auto power = [](auto const &M, nda::vector<double> v) {
+    for (int i = 0; i < 5; ++i) v = M * v;
+    return v;
+  };
+  EXPECT_ARRAY_NEAR(power(A, x), power(D, x), 1.e-8);
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2021 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Authors: Olivier Parcollet, Nils Wentzell
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// A full test matrix with a dominant diagonal, so that its triangles are well conditioned even with a unit diagonal
+template <typename T, typename Layout>
+nda::matrix<T, Layout> make_full(long n) {
+  return nda::matrix<T, Layout>{make_test_matrix<T, Layout>(n, n, n * (n + 2.0)) / double(n)};
+}
+
+// ==============================================================
+
+template <typename T, typename Layout, typename RhsLayout, typename Tri>
+void test_triangular_view(Tri const &t) {
+  long n   = t.dim();
+  auto D   = t.to_dense();
+  auto x   = nda::vector<T>(n);
+  auto X   = nda::matrix<T, RhsLayout>(n, 3);
+  auto Y   = nda::matrix<T, RhsLayout>(3, n);
+  for (long i = 0; i < n; ++i) x(i) = 1.0 / (i + 2);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < 3; ++j) X(i, j) = Y(j, i) = i - 2.0 * j + 0.5;
+
+  // Products
+  EXPECT_ARRAY_NEAR(t * x, D * x, 1.e-13);
+  EXPECT_ARRAY_NEAR(t * X, D * X, 1.e-13);
+  EXPECT_ARRAY_NEAR(Y * t, Y * D, 1.e-13);
+
+  // Transposition
+  auto tt = transpose(t);
+  EXPECT_ARRAY_NEAR(tt.to_dense(), nda::transpose(D), 1.e-15);
+  EXPECT_ARRAY_NEAR(tt * X, nda::transpose(D) * X, 1.e-13);
+
+  // Solves
+  EXPECT_ARRAY_NEAR(D * nda::linalg::solve(t, x), x, 1.e-13);
+  EXPECT_ARRAY_NEAR(D * nda::linalg::solve(t, X), X, 1.e-13);
+  EXPECT_ARRAY_NEAR(nda::transpose(D) * nda::linalg::solve(tt, X), X, 1.e-13);
+
+  // In place, with the layout of the right hand side kept
+  auto X1 = X;
+  nda::linalg::solve_in_place(t, X1);
+  EXPECT_ARRAY_NEAR(D * X1, X, 1.e-13);
+
+  // Strided right hand sides
+  auto x2 = nda::vector<T>(2 * n);
+  x2(range(0, 2 * n, 2)) = x;
+  nda::linalg::solve_in_place(t, x2(range(0, 2 * n, 2)));
+  EXPECT_ARRAY_NEAR(D * nda::vector<T>{x2(range(0, 2 * n, 2))}, x, 1.e-13);
+  auto X2 = nda::matrix<T, RhsLayout>(n, 6);
+  X2(range(), range(0, 6, 2)) = X;
+  nda::linalg::solve_in_place(t, X2(range(), range(0, 6, 2)));
+  EXPECT_ARRAY_NEAR(D * X2(range(), range(0, 6, 2)), X, 1.e-13);
+}
+
+template <typename T, typename Layout, typename RhsLayout>
+void test_triangular() {
+  long n = 7;
+  auto M = make_full<T, Layout>(n);
+  test_triangular_view<T, Layout, RhsLayout>(nda::upper_triangular(M));
+  test_triangular_view<T, Layout, RhsLayout>(nda::lower_triangular(M));
+  test_triangular_view<T, Layout, RhsLayout>(nda::upper_triangular(M, true));
+  test_triangular_view<T, Layout, RhsLayout>(nda::lower_triangular(M, true));
+
+  // A view on a diagonal block of a larger matrix
+  auto L = make_full<T, Layout>(n + 3);
+  test_triangular_view<T, Layout, RhsLayout>(nda::lower_triangular(L(range(2, n + 2), range(2, n + 2))));
+}
+
+TEST(Triangular, Solve) { //NOLINT
+  for_each_type_and_layout([](auto t, auto l) {
+    test_triangular<decltype(t), decltype(l), nda::C_layout>();
+    test_triangular<decltype(t), decltype(l), nda::F_layout>();
+  });
+}
+
+TEST(Triangular, Access) { //NOLINT
+  auto M = make_full<double, nda::C_layout>(3);
+  auto U = nda::upper_triangular(M, true);
+  EXPECT_EQ(U(0, 0), 1.0);
+  EXPECT_EQ(U(0, 2), M(0, 2));
+  EXPECT_EQ(U(2, 0), 0.0);
+  EXPECT_EQ(decltype(U)::uplo, 'U');
+  EXPECT_EQ(decltype(transpose(U))::uplo, 'L');
+
+  // The view is not a copy
+  M(0, 2) = 10;
+  EXPECT_EQ(U(0, 2), 10);
+}
+
+TEST(Triangular, Singular) { //NOLINT
+  auto M  = make_full<double, nda::F_layout>(3);
+  M(1, 1) = 0;
+  auto b  = nda::vector<double>{1, 2, 3};
+  EXPECT_THROW(nda::linalg::solve(nda::upper_triangular(M), b), nda::runtime_error); //NOLINT
+  EXPECT_NO_THROW(nda::linalg::solve(nda::upper_triangular(M, true), b));           //NOLINT
+}
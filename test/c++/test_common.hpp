@@ -48,6 +48,41 @@ using nda::F_layout;
 using nda::matrix;
 using nda::matrix_view;
 
+// A deterministic dense m x n test matrix, with complex elements for a complex T and shift added to the diagonal.
+// The elements are not separable in (i, j), so that the matrix has full rank. A different seed gives a different matrix.
+template <typename T, typename Layout = nda::C_layout>
+nda::matrix<T, Layout> make_test_matrix(long m, long n, double shift = 0, long seed = 0) {
+  auto a = nda::matrix<T, Layout>(m, n);
+  for (long i = 0; i < m; ++i)
+    for (long j = 0; j < n; ++j) {
+      if constexpr (nda::is_complex_v<T>)
+        a(i, j) = T(std::sin(1.0 + i + 3 * j * j + 0.7 * i * j + seed), std::cos(2.0 * i - j * j + seed));
+      else
+        a(i, j) = std::sin(1.0 + i + 3 * j * j + 0.7 * i * j + seed);
+      if (i == j) a(i, j) += shift;
+    }
+  return a;
+}
+
+// A deterministic symmetric (real T) or hermitian (complex T) n x n test matrix, the hermitian part of make_test_matrix
+template <typename T, typename Layout = nda::C_layout>
+nda::matrix<T, Layout> make_test_hermitian(long n, double shift = 0, long seed = 0) {
+  auto a = make_test_matrix<T, Layout>(n, n, shift, seed);
+  auto h = nda::matrix<T, Layout>(n, n);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < n; ++j) h(i, j) = (a(i, j) + nda::conj(a(j, i))) / 2.0;
+  return h;
+}
+
+// Call f(T{}, Layout{}) for each T in {double, dcomplex} and each Layout in {C_layout, F_layout}
+template <typename F>
+void for_each_type_and_layout(F const &f) {
+  f(double{}, nda::C_layout{});
+  f(double{}, nda::F_layout{});
+  f(dcomplex{}, nda::C_layout{});
+  f(dcomplex{}, nda::F_layout{});
+}
+
 #define MAKE_MAIN_MPI                                                                                                                                \
   int main(int argc, char **argv) {                                                                                                                  \
     ::testing::InitGoogleTest(&argc, argv);                                                                                                          \